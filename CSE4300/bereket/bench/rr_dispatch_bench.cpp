@@ -0,0 +1,54 @@
+// Round Robin dispatch cost vs. ready-queue length.
+//
+// Fills the queue created by RoundRobinPolicy with N jobs, then times
+// pop + requeue cycles (one dispatch and one expired slice each).
+// With the intrusive FIFO the per-dispatch cost should stay flat from 100 to 1M jobs.
+//
+// Build (from CSE4300/bereket):
+//   g++ -std=c++17 -O2 -Iinclude bench/rr_dispatch_bench.cpp src/*.cpp -o rr_bench -pthread
+
+#include "ready_queue.h"
+#include "rr_policy.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace chronos;
+
+namespace {
+
+constexpr int DISPATCHES = 2000000;
+
+double nsPerDispatch(std::size_t queue_length) {
+    RoundRobinPolicy policy(2);
+    std::unique_ptr<ReadyQueue> queue = policy.createReadyQueue();
+    for (std::size_t i = 0; i < queue_length; ++i) {
+        queue->push(Job(static_cast<int>(i + 1), static_cast<float>(i), 10.0f, 1));
+    }
+
+    Job job(0, 0.0f, 0.0f);
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < DISPATCHES; ++i) {
+        queue->pop(job);
+        job.setRemainingTime(job.getRemainingTime() - 0.001f);
+        queue->requeue(job);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return std::chrono::duration<double, std::nano>(elapsed).count() / DISPATCHES;
+}
+
+} // namespace
+
+int main() {
+    const std::vector<std::size_t> sizes = {100, 1000, 10000, 100000, 1000000};
+
+    std::printf("%10s | %14s\n", "jobs", "ns/dispatch");
+    std::printf("-----------+----------------\n");
+    for (std::size_t size : sizes) {
+        std::printf("%10zu | %14.1f\n", size, nsPerDispatch(size));
+    }
+    return 0;
+}
@@ -0,0 +1,516 @@
+// Scheduler microbenchmarks with JSON output, for tracking regressions
+// between commits.
+//
+//   getNextJob/<policy>/<n>    ns per ISchedulingPolicy::getNextJob scan of n ready jobs
+//   dispatch/<policy>/<n>      ns per pop + onJobCompletion + requeue on the policy's
+//                              ReadyQueue holding n jobs, and heap allocations per dispatch
+//   engine/event/<policy>/<n>  discrete-event runs of n jobs, repeated for --min-time:
+//                              scheduling events/s (arrivals, dispatches, slice ends,
+//                              completions, I/O) and heap allocations per dispatch
+//   engine/event-virtual/<policy>/<n>  the same through the virtual policy and
+//                              ready-queue interfaces (DispatchMode::VIRTUAL)
+//   generate/<arrivals>/<service>  ns per job drawn from a JobStream
+//   locks/<queues>/<policy>    threaded engine with lock profiling: how long workers
+//                              hold the ready-queue lock(s) per acquisition
+//   locks/burst/<policy>       same with 8 cores and jobs arriving 40 at a time, where
+//                              batch dispatch fills the idle cores under one lock
+//
+// Output follows Google Benchmark's JSON layout ("context" + "benchmarks",
+// counters as extra fields), so its compare.py can diff two runs.
+//
+// Build (from CSE4300/bereket):
+//   g++ -std=c++17 -O2 -Iinclude bench/scheduler_bench.cpp src/*.cpp -o scheduler_bench -pthread
+// Run:
+//   ./scheduler_bench [--out FILE] [--filter SUBSTRING] [--min-time SEC] [--check-allocs]
+//
+// --check-allocs exits with status 2 if any steady-state dispatch/* benchmark
+// made a heap allocation, so the allocation-free hot path can be gated in CI.
+
+#include "cfs_policy.h"
+#include "edf_policy.h"
+#include "fcfs_policy.h"
+#include "mlfq_policy.h"
+#include "priority_policy.h"
+#include "ready_queue.h"
+#include "rr_policy.h"
+#include "scheduler_engine.h"
+#include "sjf_policy.h"
+#include "srtf_policy.h"
+#include "workload_generator.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Every heap allocation in the process goes through here
+namespace {
+std::atomic<std::size_t> g_allocations{0};
+volatile std::uintptr_t g_sink = 0;    // Keeps benchmarked results observable
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+using namespace chronos;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+    std::string name;
+    std::size_t iterations = 0;
+    double ns_per_op = 0.0;      // Wall time
+    double cpu_ns_per_op = 0.0;  // Process CPU time (all threads)
+    std::vector<std::pair<std::string, double>> counters;
+};
+
+struct Options {
+    std::string out_file;
+    std::string filter;
+    double min_time = 0.2;    // Seconds each timed benchmark runs for at least
+    bool check_allocs = false;  // Fail if any dispatch/* benchmark allocated
+};
+
+struct PolicyEntry {
+    const char* name;
+    std::function<std::unique_ptr<ISchedulingPolicy>()> make;
+};
+
+const std::vector<PolicyEntry>& policies() {
+    static const std::vector<PolicyEntry> entries = {
+        {"FCFS", [] { return std::make_unique<FCFSPolicy>(); }},
+        {"SJF", [] { return std::make_unique<SJFPolicy>(); }},
+        {"Priority", [] { return std::make_unique<PriorityPolicy>(); }},
+        {"RR", [] { return std::make_unique<RoundRobinPolicy>(2); }},
+        {"MLFQ", [] { return std::make_unique<MLFQPolicy>(2); }},
+        {"CFS", [] { return std::make_unique<CFSPolicy>(2.0f); }},
+        {"SRTF", [] { return std::make_unique<SRTFPolicy>(); }},
+        {"PPriority", [] { return std::make_unique<PreemptivePriorityPolicy>(); }},
+        {"EDF", [] { return std::make_unique<EDFPolicy>(); }},
+    };
+    return entries;
+}
+
+const PolicyEntry& policyNamed(const std::string& name) {
+    for (const auto& entry : policies()) {
+        if (name == entry.name) {
+            return entry;
+        }
+    }
+    return policies().front();
+}
+
+// Same shape as schedsim's generated jobs: arrivals spread over `span`
+// seconds, bursts of burst_min..burst_max, priorities 1..5
+std::vector<Job> makeJobs(std::size_t count, float span, float burst_min, float burst_max) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> arrival_dist(0.0f, span);
+    std::uniform_real_distribution<float> burst_dist(burst_min, burst_max);
+    std::uniform_int_distribution<int> priority_dist(1, 5);
+
+    std::vector<Job> jobs;
+    jobs.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float arrival = arrival_dist(gen);
+        const float burst = burst_dist(gen);
+        jobs.emplace_back(static_cast<int>(i + 1), arrival, burst, priority_dist(gen));
+        jobs.back().setState(JobState::READY);
+    }
+    return jobs;
+}
+
+// Wall and CPU time of one call, in ns
+struct Timing {
+    double wall_ns = 0.0;
+    double cpu_ns = 0.0;
+};
+
+Timing timeOnce(const std::function<void()>& body) {
+    const std::clock_t cpu_start = std::clock();
+    const auto start = Clock::now();
+    body();
+    Timing timing;
+    timing.wall_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    timing.cpu_ns = 1e9 * static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    return timing;
+}
+
+// Run body(iterations) with growing batch sizes until one batch lasts
+// min_time, like Google Benchmark. Returns the per-iteration time of that batch.
+Timing timeLoop(double min_time, std::size_t& iterations,
+                const std::function<void(std::size_t)>& body) {
+    iterations = 1;
+    while (true) {
+        Timing timing = timeOnce([&] { body(iterations); });
+        const double seconds = timing.wall_ns * 1e-9;
+        if (seconds >= min_time || iterations >= (std::size_t{1} << 32)) {
+            timing.wall_ns /= static_cast<double>(iterations);
+            timing.cpu_ns /= static_cast<double>(iterations);
+            return timing;
+        }
+        // Aim a little past min_time, growing at most 10x per round
+        const double scale = seconds > 0.0 ? std::min(10.0, 1.4 * min_time / seconds) : 10.0;
+        iterations = std::max(iterations + 1, static_cast<std::size_t>(iterations * scale));
+    }
+}
+
+Result benchGetNextJob(const PolicyEntry& entry, std::size_t n, const Options& options) {
+    auto policy = entry.make();
+    std::vector<Job> ready = makeJobs(n, 100.0f, 1.0f, 10.0f);
+
+    std::size_t iterations = 0;
+    std::uintptr_t sink = 0;
+    const Timing timing = timeLoop(options.min_time, iterations, [&](std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            sink += reinterpret_cast<std::uintptr_t>(policy->getNextJob(ready));
+        }
+    });
+    g_sink = sink;
+    return Result{std::string("getNextJob/") + entry.name + "/" + std::to_string(n), iterations,
+                  timing.wall_ns, timing.cpu_ns, {}};
+}
+
+Result benchDispatch(const PolicyEntry& entry, std::size_t n, const Options& options) {
+    auto policy = entry.make();
+    std::unique_ptr<ReadyQueue> queue = policy->createReadyQueue();
+    for (Job& job : makeJobs(n, 100.0f, 1.0f, 10.0f)) {
+        queue->push(std::move(job));
+    }
+
+    // One dispatch: pop the policy's next job, end a short slice, requeue it
+    Job job(0, 0.0f, 0.0f);
+    double now = 0.0;
+    auto dispatch = [&] {
+        queue->pop(job);
+        now += 0.001;
+        job.setLastSlice(0.001f);
+        job.setRemainingTime(job.getRemainingTime() > 0.002f ? job.getRemainingTime() - 0.001f
+                                                             : job.getBurstTime());
+        job.setState(JobState::READY);
+        policy->onJobCompletion(&job, now);
+        queue->requeue(std::move(job));
+    };
+
+    // Cycle every job through once first, so queues that redistribute jobs
+    // (MLFQ levels) have reached their steady-state sizes before counting
+    for (std::size_t i = 0; i < n; ++i) {
+        dispatch();
+    }
+
+    std::size_t allocations = 0;
+    std::size_t iterations = 0;
+    const Timing timing = timeLoop(options.min_time, iterations, [&](std::size_t count) {
+        const std::size_t before = g_allocations.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < count; ++i) {
+            dispatch();
+        }
+        allocations = g_allocations.load(std::memory_order_relaxed) - before;
+    });
+
+    return Result{std::string("dispatch/") + entry.name + "/" + std::to_string(n), iterations,
+                  timing.wall_ns, timing.cpu_ns,
+                  {{"allocs_per_dispatch", static_cast<double>(allocations) / static_cast<double>(iterations)}}};
+}
+
+Result benchGenerate(ArrivalModel arrivals, ServiceModel service, const Options& options) {
+    GeneratorConfig config;
+    config.num_jobs = std::uint64_t{1} << 62;
+    config.arrivals = arrivals;
+    config.service = service;
+    config.tenants = {{0.8, 3, 5}, {0.2, 1, 2}};
+    JobStream stream(config);
+
+    Job job(0, 0.0f, 0.0f);
+    float sink = 0.0f;
+    std::size_t iterations = 0;
+    const Timing timing = timeLoop(options.min_time, iterations, [&](std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            stream.next(job);
+            sink += job.getBurstTime();
+        }
+    });
+    g_sink = static_cast<std::uintptr_t>(sink);
+    return Result{"generate/" + WorkloadGenerator::arrivalToString(arrivals) + "/" +
+                      WorkloadGenerator::serviceToString(service),
+                  iterations, timing.wall_ns, timing.cpu_ns,
+                  {{"jobs_per_second", 1e9 / timing.wall_ns}}};
+}
+
+Result benchEventEngine(const PolicyEntry& entry, std::size_t n, int cores, const Options& options,
+                        DispatchMode dispatch = DispatchMode::STATIC) {
+    auto policy = entry.make();
+    std::vector<Job> jobs = makeJobs(n, static_cast<float>(n) * 5.5f / static_cast<float>(cores),
+                                     1.0f, 10.0f);
+    // Sorted once, so each run copies jobs as they arrive instead of the whole set
+    SchedulerEngine::sortByArrival(jobs);
+
+    EngineConfig config;
+    config.mode = EngineMode::DISCRETE_EVENT;
+    config.dispatch = dispatch;
+    config.print_summary = false;
+    SchedulerEngine engine(config);
+
+    // Whole runs, repeated until they last min_time like every other benchmark;
+    // every run schedules the same events
+    ScheduleResult result;
+    std::size_t allocations = 0;
+    std::size_t iterations = 0;
+    const Timing timing = timeLoop(options.min_time, iterations, [&](std::size_t count) {
+        const std::size_t before = g_allocations.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < count; ++i) {
+            result = engine.run(jobs, *policy, cores);
+        }
+        allocations = g_allocations.load(std::memory_order_relaxed) - before;
+    });
+
+    const double dispatches = static_cast<double>(result.context_switches);
+    const double events = static_cast<double>(result.completed_jobs.size() + 2 * result.context_switches +
+                                              2 * result.io_requests);
+    const double runs = static_cast<double>(iterations);
+    const char* prefix = dispatch == DispatchMode::STATIC ? "engine/event/" : "engine/event-virtual/";
+    return Result{std::string(prefix) + entry.name + "/" + std::to_string(n), iterations,
+                  timing.wall_ns, timing.cpu_ns,
+                  {{"events", events},
+                   {"events_per_second", events * 1e9 / timing.wall_ns},
+                   {"dispatches", dispatches},
+                   {"allocs_per_dispatch",
+                    dispatches > 0.0 ? static_cast<double>(allocations) / runs / dispatches : 0.0}}};
+}
+
+Result benchLocks(const PolicyEntry& entry, QueueMode queue_mode, int cores, bool bursty = false) {
+    auto policy = entry.make();
+    // Millisecond bursts keep the real-time engine quick
+    std::vector<Job> jobs = makeJobs(400, 0.1f, 0.001f, 0.004f);
+    if (bursty) {
+        // Ten arrival instants, 25 ms apart, of 40 jobs each
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            const Job& job = jobs[i];
+            jobs[i] = Job(job.getId(), 0.025f * static_cast<float>(i / 40), job.getBurstTime(),
+                          job.getPriority());
+            jobs[i].setState(JobState::READY);
+        }
+    }
+
+    EngineConfig config;
+    config.mode = EngineMode::THREADED;
+    config.queue_mode = queue_mode;
+    config.print_summary = false;
+    config.profile_locks = true;
+    SchedulerEngine engine(config);
+
+    ScheduleResult result;
+    const Timing timing = timeOnce([&] { result = engine.run(std::move(jobs), *policy, cores); });
+
+    const LockStats& locks = result.queue_locks;
+    const std::string queues =
+        bursty ? "burst" : queue_mode == QueueMode::GLOBAL ? "global" : "per-core";
+    const double dispatches = static_cast<double>(std::max<std::size_t>(1, result.context_switches));
+    return Result{"locks/" + queues + "/" + entry.name, 1, timing.wall_ns, timing.cpu_ns,
+                  {{"lock_acquisitions", static_cast<double>(locks.acquisitions)},
+                   {"locks_per_dispatch", static_cast<double>(locks.acquisitions) / dispatches},
+                   {"lock_hold_mean_ns", locks.meanNs()},
+                   {"lock_hold_max_ns", locks.max_ns},
+                   {"lock_hold_total_ns", locks.total_ns}}};
+}
+
+std::string jsonNumber(double value) {
+    std::ostringstream out;
+    out.precision(10);
+    out << value;
+    return out.str();
+}
+
+void writeJson(std::ostream& out, const std::vector<Result>& results, const char* executable) {
+    char date[64];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << date << "\",\n"
+        << "    \"executable\": \"" << executable << "\",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+        << "    \"library_build_type\": \"release\"\n"
+#else
+        << "    \"library_build_type\": \"debug\"\n"
+#endif
+        << "  },\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        out << "    {\n"
+            << "      \"name\": \"" << result.name << "\",\n"
+            << "      \"run_name\": \"" << result.name << "\",\n"
+            << "      \"run_type\": \"iteration\",\n"
+            << "      \"iterations\": " << result.iterations << ",\n"
+            << "      \"real_time\": " << jsonNumber(result.ns_per_op) << ",\n"
+            << "      \"cpu_time\": " << jsonNumber(result.cpu_ns_per_op) << ",\n"
+            << "      \"time_unit\": \"ns\"";
+        for (const auto& counter : result.counters) {
+            out << ",\n      \"" << counter.first << "\": " << jsonNumber(counter.second);
+        }
+        out << "\n    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+bool parseArgs(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if ((arg == "--out" || arg == "--filter" || arg == "--min-time") && i + 1 >= argc) {
+            std::cerr << "Error: " << arg << " requires a value\n";
+            return false;
+        }
+        if (arg == "--out") {
+            options.out_file = argv[++i];
+        } else if (arg == "--filter") {
+            options.filter = argv[++i];
+        } else if (arg == "--check-allocs") {
+            options.check_allocs = true;
+        } else if (arg == "--min-time") {
+            options.min_time = std::atof(argv[++i]);
+            if (!(options.min_time > 0.0)) {
+                std::cerr << "Error: --min-time must be a positive number of seconds\n";
+                return false;
+            }
+        } else {
+            std::cerr << "Usage: scheduler_bench [--out FILE] [--filter SUBSTRING] [--min-time SEC]"
+                         " [--check-allocs]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        return 1;
+    }
+
+    // Each benchmark is registered by name so --filter can skip it unbuilt
+    std::vector<std::pair<std::string, std::function<Result()>>> benchmarks;
+    for (const auto& entry : policies()) {
+        for (std::size_t n : {16, 256, 4096, 65536}) {
+            benchmarks.emplace_back(std::string("getNextJob/") + entry.name + "/" + std::to_string(n),
+                                    [&entry, n, &options] { return benchGetNextJob(entry, n, options); });
+        }
+    }
+    for (const auto& entry : policies()) {
+        for (std::size_t n : {100, 10000, 1000000}) {
+            benchmarks.emplace_back(std::string("dispatch/") + entry.name + "/" + std::to_string(n),
+                                    [&entry, n, &options] { return benchDispatch(entry, n, options); });
+        }
+    }
+    for (const char* name : {"FCFS", "RR", "CFS", "SRTF"}) {
+        const PolicyEntry& entry = policyNamed(name);
+        benchmarks.emplace_back(std::string("engine/event/") + name + "/100000",
+                                [&entry, &options] { return benchEventEngine(entry, 100000, 4, options); });
+        benchmarks.emplace_back(std::string("engine/event-virtual/") + name + "/100000", [&entry, &options] {
+            return benchEventEngine(entry, 100000, 4, options, DispatchMode::VIRTUAL);
+        });
+    }
+    for (ArrivalModel arrivals : {ArrivalModel::POISSON, ArrivalModel::MMPP, ArrivalModel::DIURNAL}) {
+        for (ServiceModel service : {ServiceModel::UNIFORM, ServiceModel::PARETO,
+                                     ServiceModel::LOGNORMAL, ServiceModel::BIMODAL}) {
+            benchmarks.emplace_back("generate/" + WorkloadGenerator::arrivalToString(arrivals) + "/" +
+                                        WorkloadGenerator::serviceToString(service),
+                                    [arrivals, service, &options] {
+                                        return benchGenerate(arrivals, service, options);
+                                    });
+        }
+    }
+    for (const char* name : {"FCFS", "RR"}) {
+        const PolicyEntry& entry = policyNamed(name);
+        benchmarks.emplace_back(std::string("locks/global/") + name,
+                                [&entry] { return benchLocks(entry, QueueMode::GLOBAL, 4); });
+        benchmarks.emplace_back(std::string("locks/per-core/") + name,
+                                [&entry] { return benchLocks(entry, QueueMode::PER_CORE, 4); });
+        benchmarks.emplace_back(std::string("locks/burst/") + name,
+                                [&entry] { return benchLocks(entry, QueueMode::GLOBAL, 8, true); });
+    }
+
+    std::vector<Result> results;
+    for (const auto& benchmark : benchmarks) {
+        if (!options.filter.empty() && benchmark.first.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        results.push_back(benchmark.second());
+        const Result& result = results.back();
+        std::fprintf(stderr, "%-32s %14.1f ns %12zu it", result.name.c_str(), result.ns_per_op,
+                     result.iterations);
+        for (const auto& counter : result.counters) {
+            std::fprintf(stderr, "  %s=%.4g", counter.first.c_str(), counter.second);
+        }
+        std::fprintf(stderr, "\n");
+    }
+
+    int status = 0;
+    if (options.check_allocs) {
+        for (const Result& result : results) {
+            if (result.name.compare(0, 9, "dispatch/") != 0) {
+                continue;
+            }
+            for (const auto& counter : result.counters) {
+                if (counter.first == "allocs_per_dispatch" && counter.second > 0.0) {
+                    std::cerr << "Error: " << result.name << " allocated on the dispatch path ("
+                              << counter.second << " per dispatch)\n";
+                    status = 2;
+                }
+            }
+        }
+    }
+
+    if (options.out_file.empty()) {
+        writeJson(std::cout, results, argv[0]);
+        return status;
+    }
+    std::ofstream out(options.out_file);
+    if (!out) {
+        std::cerr << "Error: Could not open file for writing: " << options.out_file << "\n";
+        return 1;
+    }
+    writeJson(out, results, argv[0]);
+    std::cerr << "Results written to " << options.out_file << "\n";
+    return status;
+}
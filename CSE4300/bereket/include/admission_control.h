@@ -0,0 +1,133 @@
+#ifndef CHRONOS_ADMISSION_CONTROL_H
+#define CHRONOS_ADMISSION_CONTROL_H
+
+#include "job.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace chronos {
+
+// Built-in admission tests run on every arrival before it is queued
+enum class AdmissionKind {
+    NONE,           // Admit everything
+    QUEUE_LENGTH,   // Admit while fewer than max_queued jobs are waiting
+    TOKEN_BUCKET,   // Admit at most `rate` jobs per second, in bursts of up to `burst`
+    PREDICTED_WAIT  // Admit if the predicted wait still meets the job's deadline
+};
+
+// What happens to an arrival that fails the test
+enum class AdmissionAction {
+    REJECT,         // Dropped: the job never runs
+    DOWNGRADE       // Admitted as best-effort (best-effort jobs are rejected)
+};
+
+// Admission settings chosen once per run (usually from CLIOptions)
+struct AdmissionConfig {
+    AdmissionKind kind = AdmissionKind::NONE;
+    AdmissionAction action = AdmissionAction::REJECT;
+    std::size_t max_queued = 0;     // QUEUE_LENGTH
+    double rate = 0.0;              // TOKEN_BUCKET: jobs per simulated second
+    double burst = 1.0;             // TOKEN_BUCKET: bucket size in jobs
+    double max_wait = 0.0;          // PREDICTED_WAIT: limit for jobs without a deadline (0: none)
+
+    bool enabled() const { return kind != AdmissionKind::NONE; }
+};
+
+// Load the engine sees when a job arrives
+struct AdmissionView {
+    std::size_t queued = 0;         // Jobs waiting in the ready queue(s)
+    int num_cores = 1;
+};
+
+// Arrival outcomes of one run
+struct AdmissionStats {
+    std::size_t arrivals = 0;
+    std::size_t rejected = 0;
+    std::size_t rejected_deadlines = 0; // ... of which had a deadline
+    std::size_t downgraded = 0;
+};
+
+// Screens arrivals at the engine's front door. One instance per run, called
+// in arrival order from a single thread (the event loop, or the threaded
+// engine's scheduler thread). Time is the job's arrival time.
+class AdmissionController {
+public:
+    explicit AdmissionController(AdmissionAction action)
+        : action_(action) {}
+    virtual ~AdmissionController() = default;
+
+    // False if the job must be dropped. A job that fails the test under
+    // DOWNGRADE is admitted after job.downgrade() unless it is already best-effort.
+    bool admit(Job& job, const AdmissionView& view);
+
+    const AdmissionStats& stats() const { return stats_; }
+    virtual std::string getName() const = 0;
+
+protected:
+    // The test itself; called once per arrival, in arrival order
+    virtual bool hasRoom(const Job& job, const AdmissionView& view) = 0;
+
+private:
+    AdmissionAction action_;
+    AdmissionStats stats_;
+};
+
+class QueueLengthAdmission final : public AdmissionController {
+public:
+    QueueLengthAdmission(std::size_t max_queued, AdmissionAction action);
+    std::string getName() const override;
+
+protected:
+    bool hasRoom(const Job& job, const AdmissionView& view) override;
+
+private:
+    std::size_t max_queued_;
+};
+
+// Refills at rate tokens per second of arrival time up to burst tokens;
+// every admitted job takes one
+class TokenBucketAdmission final : public AdmissionController {
+public:
+    TokenBucketAdmission(double rate, double burst, AdmissionAction action);
+    std::string getName() const override;
+
+protected:
+    bool hasRoom(const Job& job, const AdmissionView& view) override;
+
+private:
+    double rate_;
+    double burst_;
+    double tokens_;
+    double last_refill_ = 0.0;
+    bool started_ = false;
+};
+
+// Predicts the wait as the queued work spread over the cores, taking the
+// mean burst of the arrivals so far as every queued job's size. A job with a
+// deadline is admitted if it can still finish by it after that wait; one
+// without is admitted if the wait is at most max_wait (always, when 0).
+class PredictedWaitAdmission final : public AdmissionController {
+public:
+    PredictedWaitAdmission(double max_wait, AdmissionAction action);
+    std::string getName() const override;
+
+protected:
+    bool hasRoom(const Job& job, const AdmissionView& view) override;
+
+private:
+    double max_wait_;
+    double burst_sum_ = 0.0;
+    std::size_t burst_count_ = 0;
+};
+
+// nullptr for AdmissionKind::NONE
+std::unique_ptr<AdmissionController> createAdmissionController(const AdmissionConfig& config);
+
+std::string admissionToString(const AdmissionConfig& config);
+std::string admissionActionToString(AdmissionAction action);
+
+}
+
+#endif
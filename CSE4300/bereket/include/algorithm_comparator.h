@@ -5,16 +5,42 @@
 #include "scheduling_policy.h"
 #include "cli_parser.h"
 
+#include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace chronos {
 
+// Parameter grid for a sweep: every algorithm x core count x quantum x seed.
+// Quanta only apply to time-sliced algorithms; other algorithms run once per
+// (cores, seed) pair instead of once per quantum.
+struct SweepGrid {
+    std::vector<SchedulingAlgorithm> algorithms;
+    std::vector<int> core_counts;
+    std::vector<int> quanta;
+    std::vector<unsigned int> seeds;
+    int threads = 0;    // Worker threads running cells (0 = hardware concurrency)
+};
+
+// Builds the job set for one seed. Called once per seed; every cell with that
+// seed shares the resulting (read-only) workload.
+using WorkloadFactory = std::function<std::vector<Job>(unsigned int seed)>;
+
 // Runs all scheduling algorithms on the same job set and compares results
 class AlgorithmComparator {
 public:
-    // Run all algorithms (FCFS, SJF, Priority, RR) on the same job set
-    static bool compareAll(std::vector<Job> jobs, int num_cores, int quantum = 2);
+    // Run all algorithms (FCFS, SJF, Priority, RR, MLFQ, CFS, SRTF,
+    // Preemptive Priority, EDF) on the same job set
+    static bool compareAll(std::vector<Job> jobs, int num_cores, int quantum = 2,
+                           const EngineConfig& engine = EngineConfig());
+    
+    // Run every cell of the grid in parallel and write one row per cell to filename.
+    // Each cell formats its row into its own buffer; rows are written in grid order at the end.
+    static bool sweep(const SweepGrid& grid,
+                      const WorkloadFactory& make_workload,
+                      const EngineConfig& engine = EngineConfig(),
+                      const std::string& filename = "output/sweep.csv");
     
     // Print comparison summary table
     static void printComparisonSummary();
@@ -29,6 +55,7 @@ private:
         std::vector<Job> jobs,
         std::unique_ptr<ISchedulingPolicy> policy,
         int num_cores,
+        const EngineConfig& engine,
         const std::string& output_dir = "output");
 };
 
@@ -0,0 +1,107 @@
+#ifndef CHRONOS_CFS_POLICY_H
+#define CHRONOS_CFS_POLICY_H
+
+#include "job_index.h"
+#include "node_pool.h"
+#include "ready_queue.h"
+#include "scheduling_policy.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace chronos {
+
+class CFSReadyQueue;
+
+// Completely-fair-scheduler style policy (preemptive).
+// Every job accumulates virtual runtime: real CPU time scaled by
+// NICE_0_WEIGHT / weight, where the weight follows the Linux nice table
+// (priority 3 = nice 0; each priority step is about 1.25x more CPU share).
+// The job with the smallest vruntime runs next, for a slice of
+// target_latency * weight / runnable_weight, but never less than
+// min_granularity.
+class CFSPolicy final : public ISchedulingPolicy {
+public:
+    static constexpr float NICE_0_WEIGHT = 1024.0f;
+
+    // min_granularity <= 0 picks target_latency / 8
+    explicit CFSPolicy(float target_latency, float min_granularity = 0.0f);
+    ~CFSPolicy() override = default;
+
+    // Smallest vruntime, tie-break on job id (ScanReadyQueue fallback)
+    Job* getNextJob(std::vector<Job>& ready_queue) override;
+
+    // Charge the slice just run to the job's vruntime
+    void onJobCompletion(Job* completed_job, double current_time) override;
+
+    std::string getName() const override { return "CFS"; }
+    bool isPreemptive() const override { return true; }
+
+    // Scheduling period; per-job slices are the job's weighted share of it
+    float getTimeSlice() const override { return target_latency_; }
+    float getTimeSlice(const Job& job) const override;
+
+    float getMinGranularity() const { return min_granularity_; }
+
+    static float weightOf(const Job& job);
+
+    // Weight of the jobs waiting in this policy's ready queues
+    void addQueuedWeight(float weight);
+
+    // Red-black tree keyed by vruntime: O(log n) push, pop and remove
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = CFSReadyQueue;
+
+private:
+    float target_latency_;
+    float min_granularity_;
+    std::atomic<std::int64_t> queued_weight_{0};    // Weights are integers in the nice table
+};
+
+// Ready queue for CFSPolicy: std::map (a red-black tree) ordered by
+// (vruntime, insertion order). New arrivals start at the queue's
+// min_vruntime so they neither starve nor are starved by long-running jobs.
+class CFSReadyQueue final : public ReadyQueue {
+public:
+    explicit CFSReadyQueue(CFSPolicy& policy);
+
+    void push(Job job) override;
+    void requeue(Job job) override;
+    bool pop(Job& out) override;
+    bool remove(int job_id, Job& out) override;
+    bool contains(int job_id) const override;
+    std::size_t size() const override { return tree_.size(); }
+
+    float minVruntime() const { return min_vruntime_; }
+
+private:
+    struct Key {
+        float vruntime;
+        std::uint64_t seq;
+        bool operator<(const Key& other) const {
+            return vruntime != other.vruntime ? vruntime < other.vruntime : seq < other.seq;
+        }
+    };
+
+    using Tree = std::map<Key, Job, std::less<Key>, PoolAllocator<std::pair<const Key, Job>>>;
+
+    void insert(Job job);
+
+    CFSPolicy& policy_;
+    // Tree nodes are recycled through node_pool_ (declared before the tree, so it
+    // outlives the tree): steady-state push/pop do not allocate
+    NodePool node_pool_;
+    Tree tree_;
+    JobIndex<Key> index_;     // job id -> tree key
+    float min_vruntime_ = 0.0f;
+    std::uint64_t next_seq_ = 0;
+};
+
+}
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef CHRONOS_CLI_PARSER_H
 #define CHRONOS_CLI_PARSER_H
 
+#include "scheduler_engine.h"
+#include "workload_generator.h"
+
 #include <string>
 #include <vector>
 #include <optional>
@@ -13,6 +16,11 @@ enum class SchedulingAlgorithm {
     SJF,         // Shortest Job First
     PRIORITY,    // Priority Scheduling
     RR,          // Round Robin
+    MLFQ,        // Multi-Level Feedback Queue
+    CFS,         // Completely Fair (vruntime) Scheduling
+    SRTF,        // Shortest Remaining Time First (preemptive SJF)
+    PRIORITY_PREEMPTIVE, // Priority, preempting on higher-priority arrivals
+    EDF,         // Earliest Deadline First (preemptive)
 };
 
 struct CLIOptions {
@@ -21,6 +29,55 @@ struct CLIOptions {
     int num_jobs = 0;
     std::optional<int> quantum = 1;
     bool compare_all = false;
+    EngineConfig engine;
+
+    // Fixed seed for job generation (random_device when unset)
+    std::optional<unsigned int> seed;
+
+    // Fraction of generated jobs that alternate CPU and I/O bursts
+    float io_mix = 0.0f;
+
+    // Synthetic workload models (--arrivals, --service, --tenants, ...). Without
+    // any of them jobs come from the uniform sample generator. seed and num_jobs
+    // are filled in from --seed / --jobs; an unset rate targets 80% core load.
+    bool use_generator = false;
+    GeneratorConfig generator;
+    std::optional<double> arrival_rate;
+
+    // Weighted fair queueing across tenants around the chosen algorithm
+    // (--fair-share); tenant t's weight is tenant_weights[t], 1 past the list
+    bool fair_share = false;
+    std::vector<double> tenant_weights;
+
+    // Only write --save-workload (streamed for generated models), no simulation
+    bool generate_only = false;
+
+    // Parameter sweep (--sweep); empty lists fall back to the single-run options
+    bool sweep = false;
+    std::vector<SchedulingAlgorithm> sweep_algorithms;
+    std::vector<int> sweep_cores;
+    std::vector<int> sweep_quanta;
+    std::vector<unsigned int> sweep_seeds;
+    int threads = 0;
+
+    // Job trace to replay (--workload) instead of generated jobs; --jobs then
+    // limits how many are read. save_workload writes the job set in binary form.
+    std::string workload_file;
+    std::string save_workload;
+
+    // Binary event trace of a single run (--trace); empty disables tracing
+    std::string trace_file;
+    bool trace_mmap = false;
+
+    // Dispatch log of a single deterministic threaded run to write (--record)
+    // and one to check the run against (--replay); either implies --deterministic
+    std::string record_file;
+    std::string replay_file;
+
+    // Live stats while runs are in progress (--live): "stderr" or "unix:PATH",
+    // empty disables them; published every live_interval_ms
+    std::string live_target;
+    int live_interval_ms = 1000;
 
     bool is_valid = false;
 };
@@ -31,10 +88,36 @@ public:
     static void printOptions(const CLIOptions& options);
     static std::string algorithmToString(const SchedulingAlgorithm& algorithm);
     static std::optional<SchedulingAlgorithm> stringToAlgorithm(const std::string& str);
+    static std::string engineModeToString(EngineMode mode);
+    static std::optional<EngineMode> stringToEngineMode(const std::string& str);
+    static std::string queueModeToString(QueueMode mode);
+    static std::optional<QueueMode> stringToQueueMode(const std::string& str);
+    static std::string dispatchModeToString(DispatchMode mode);
+    static std::optional<DispatchMode> stringToDispatchMode(const std::string& str);
+    static std::optional<PlacementStrategy> stringToPlacement(const std::string& str);
+    static std::string placementToString(PlacementStrategy strategy);
 
 private:
     // Helper: Extract integer value from argument
     static bool parseIntArg(const std::string& arg, const std::string& flag, int& value);
+
+    // Helper: Parse a comma-separated list of positive integers ("1,2,4")
+    static bool parseIntList(const std::string& str, const std::string& flag, std::vector<int>& values);
+
+    // Helper: Parse one seed for --seed or --seeds: decimal digits only, 0 to UINT_MAX
+    static bool parseSeed(const std::string& str, const std::string& flag, unsigned int& seed);
+
+    // Helper: Parse a comma-separated list of positive numbers ("3,1,0.5")
+    static bool parseWeightList(const std::string& str, const std::string& flag,
+                                std::vector<double>& values);
+
+    // Helper: Parse --admission ("queue:N", "token:RATE[:BURST]", "wait[:SEC]"
+    // or "none"); keeps config.action
+    static bool parseAdmission(const std::string& str, AdmissionConfig& config);
+
+    // Helper: Parse --core-types ("2xbig,2xlittle", "4x1.5:5:0.5") into one
+    // CoreType per core
+    static bool parseCoreTypes(const std::string& str, std::vector<CoreType>& cores);
     
     // Helper: Validate parsed options
     static bool validateOptions(const CLIOptions& options);
@@ -0,0 +1,64 @@
+#ifndef CHRONOS_COST_MODEL_H
+#define CHRONOS_COST_MODEL_H
+
+#include "job.h"
+
+#include <cstddef>
+
+namespace chronos {
+
+// Time the engines charge a core for putting a job on it, on top of the
+// job's own work. Both costs default to 0 (switching is free).
+struct CostModel {
+    float dispatch_overhead = 0.0f;   // Every dispatch (context switch)
+    float migration_penalty = 0.0f;   // Cache warm-up when a job resumes on a new core
+    float cross_socket_penalty = 0.0f; // Extra warm-up when that core is on another socket
+
+    bool enabled() const {
+        return dispatch_overhead > 0.0f || migration_penalty > 0.0f || cross_socket_penalty > 0.0f;
+    }
+
+    // A job migrates when it has run before, on a different core
+    static bool migrates(const Job& job, int core_id) {
+        return job.getLastCore() >= 0 && job.getLastCore() != core_id;
+    }
+};
+
+// Overhead charged by one engine run
+struct CostTotals {
+    double switch_overhead = 0.0;     // Sum of dispatch overheads
+    double warmup = 0.0;              // Sum of migration (and cross-socket) penalties
+    std::size_t migrations = 0;       // Dispatches onto a different core than last time
+    std::size_t remote_migrations = 0; // ... of which onto a different NUMA node
+
+    // Charge one dispatch of job onto core_id (on NUMA node node_id), then
+    // record the core and node on the job. Returns the overhead in seconds.
+    float charge(const CostModel& model, Job& job, int core_id, int node_id) {
+        float overhead = model.dispatch_overhead;
+        if (CostModel::migrates(job, core_id)) {
+            ++migrations;
+            float penalty = model.migration_penalty;
+            if (job.getLastNode() != node_id) {
+                ++remote_migrations;
+                penalty += model.cross_socket_penalty;
+            }
+            overhead += penalty;
+            warmup += penalty;
+        }
+        switch_overhead += model.dispatch_overhead;
+        job.setLastCore(core_id);
+        job.setLastNode(node_id);
+        return overhead;
+    }
+
+    void merge(const CostTotals& other) {
+        switch_overhead += other.switch_overhead;
+        warmup += other.warmup;
+        migrations += other.migrations;
+        remote_migrations += other.remote_migrations;
+    }
+};
+
+}
+
+#endif
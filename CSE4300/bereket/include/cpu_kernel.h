@@ -0,0 +1,105 @@
+#ifndef CHRONOS_CPU_KERNEL_H
+#define CHRONOS_CPU_KERNEL_H
+
+#include "latency_histogram.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// What the threaded engine's cores do for the length of a slice
+enum class ExecutionMode {
+    SLEEP,          // Sleep through it (no real CPU load)
+    SPIN,           // Dependent integer arithmetic: pure core time, no memory traffic
+    STREAM,         // Read-modify-write sweeps of a per-core buffer: memory bandwidth
+    POINTER_CHASE   // Dependent loads around a random cycle: memory latency / cache misses
+};
+
+// Real-execution settings (EngineConfig::execution)
+struct ExecutionConfig {
+    ExecutionMode mode = ExecutionMode::SLEEP;
+    double time_scale = 1.0;                    // Wall seconds of work per simulated second
+    bool pin_threads = true;                    // Pin core i to the i-th allowed host CPU
+    std::size_t working_set = 8u << 20;         // Bytes per core (STREAM, POINTER_CHASE)
+
+    bool real() const { return mode != ExecutionMode::SLEEP; }
+};
+
+// Measured against planned kernel time across a run. Planned time is what the
+// work would take at the single-thread calibrated rate, so any excess is
+// contention (shared caches, memory bandwidth, SMT, oversubscription).
+// dispatch_time is the host's real per-slice scheduling cost.
+struct ExecutionStats {
+    std::size_t slices = 0;
+    double planned_time = 0.0;      // Wall seconds at the calibrated rate
+    double measured_time = 0.0;     // Wall seconds actually spent in kernels
+    double dispatch_time = 0.0;     // Wall seconds from popping a job to its kernel
+                                    // starting, plus requeueing / completing it
+    double wall_time = 0.0;         // Whole run, workers started to workers joined
+    double units_per_second = 0.0;  // Calibrated kernel rate
+    int pinned_cores = 0;           // Cores pinned to a host CPU
+    LatencyHistogram overrun{1e-6}; // Per-slice measured - planned (wall seconds, >= 0)
+
+    void merge(const ExecutionStats& other) {
+        slices += other.slices;
+        planned_time += other.planned_time;
+        measured_time += other.measured_time;
+        dispatch_time += other.dispatch_time;
+        pinned_cores += other.pinned_cores;
+        overrun.merge(other.overrun);
+    }
+
+    // Measured / planned kernel time (1.0 = no contention)
+    double slowdown() const { return planned_time > 0.0 ? measured_time / planned_time : 0.0; }
+
+    double meanDispatchTime() const {
+        return slices == 0 ? 0.0 : dispatch_time / static_cast<double>(slices);
+    }
+};
+
+// Calibrated CPU-bound kernel. Work is counted in units of roughly a
+// microsecond or less, so a slice is a unit count (seconds x calibrated rate)
+// and a slice can be cut between units. Each core owns one kernel and its
+// working set, allocated (and first touched) by the core's own thread.
+class CpuKernel {
+public:
+    CpuKernel(ExecutionMode mode, std::size_t working_set);
+
+    // Run `units` work units, stopping early once *cancel is set.
+    // Returns the units completed.
+    std::uint64_t run(std::uint64_t units, const std::atomic<bool>* cancel = nullptr);
+
+    // Units per second on the calling thread, measured over about `seconds`
+    double calibrate(double seconds = 0.05);
+
+    ExecutionMode mode() const { return mode_; }
+
+    static std::string modeToString(ExecutionMode mode);
+    static std::optional<ExecutionMode> stringToMode(const std::string& str);
+
+    // Pin the calling thread to the (core_id mod N)-th CPU it may run on.
+    // Returns false where pinning is unsupported or refused.
+    static bool pinCurrentThread(int core_id);
+
+    // Host CPUs the process may run on
+    static int availableCpus();
+
+private:
+    void runUnit();
+
+    ExecutionMode mode_;
+    std::uint64_t spin_state_ = 0x9E3779B97F4A7C15ull;
+    std::vector<double> stream_;            // STREAM buffer
+    std::size_t stream_pos_ = 0;
+    std::vector<std::uint32_t> chase_;      // POINTER_CHASE: next index of a single cycle
+    std::uint32_t chase_pos_ = 0;
+};
+
+}
+
+#endif
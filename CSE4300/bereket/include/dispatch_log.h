@@ -0,0 +1,79 @@
+#ifndef CHRONOS_DISPATCH_LOG_H
+#define CHRONOS_DISPATCH_LOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// One dispatch of a deterministic threaded run (24 bytes, host byte order)
+struct DispatchRecord {
+    double time;             // Simulated time the slice starts (after switch overhead)
+    std::int32_t job_id;
+    std::int32_t core;
+    float slice;             // Planned slice length
+    float remaining;         // Job's CPU work left when dispatched
+};
+static_assert(sizeof(DispatchRecord) == 24, "DispatchRecord must stay 24 bytes");
+
+// File header (64 bytes)
+struct DispatchLogHeader {
+    char magic[8];           // "CHRDLOG2" (version 1 stored float times)
+    std::uint32_t record_size;
+    std::uint32_t num_cores;
+    std::uint64_t record_count;
+    std::uint32_t seed;
+    std::uint32_t reserved;
+    char algorithm[32];      // NUL-padded policy name
+};
+static_assert(sizeof(DispatchLogHeader) == 64, "DispatchLogHeader must stay 64 bytes");
+
+// Every dispatch of a deterministic threaded run, in the order the cores
+// took them. save() writes the log; a later run that load()s it compares
+// each dispatch it makes with the record at the same position, bit for bit,
+// and keeps the first one that differs, so two runs (say, before and after
+// a policy change) can be told apart at the exact decision they split on.
+// Not thread-safe: the deterministic engine records from one turn at a time.
+class DispatchLog {
+public:
+    // Append a dispatch, checking it against the replayed log if there is one
+    void record(const DispatchRecord& dispatch);
+
+    // Returns false (with a message on std::cerr) if the file cannot be written
+    bool save(const std::string& path, const std::string& algorithm, int num_cores,
+              std::uint32_t seed) const;
+
+    // Load a recorded log for the next run to be checked against
+    bool load(const std::string& path);
+
+    // Clear the recorded dispatches (the replayed log is kept)
+    void restart();
+
+    const std::vector<DispatchRecord>& records() const { return records_; }
+    bool replaying() const { return !path_.empty(); }
+
+    // Replay verdict: every dispatch so far matches the log, and the run made
+    // as many as the log holds
+    bool matches() const;
+
+    // Print the replay verdict: a match, or the first divergent dispatch of both runs
+    void printReplay(std::ostream& out, const std::string& algorithm, int num_cores) const;
+
+private:
+    std::vector<DispatchRecord> records_;
+
+    // Replayed log
+    std::string path_;
+    std::vector<DispatchRecord> expected_;
+    std::string expected_algorithm_;
+    int expected_cores_ = 0;
+    std::uint32_t expected_seed_ = 0;
+    std::size_t divergence_ = SIZE_MAX;   // First record that differs (SIZE_MAX: none)
+};
+
+}
+
+#endif
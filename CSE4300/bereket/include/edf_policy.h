@@ -0,0 +1,67 @@
+#ifndef CHRONOS_EDF_POLICY_H
+#define CHRONOS_EDF_POLICY_H
+
+#include "heap_ready_queue.h"
+#include "scheduling_policy.h"
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// Dispatch order: best-effort jobs (including downgraded ones) after all
+// others, then earliest absolute deadline (jobs without one last), then the
+// more critical SLO class, then arrival time, then job id.
+struct EDFOrder {
+    // Whether a has to run before b whatever their arrival order
+    static bool moreUrgent(const Job& a, const Job& b) {
+        const bool a_best_effort = a.getSloClass() == SloClass::BEST_EFFORT;
+        const bool b_best_effort = b.getSloClass() == SloClass::BEST_EFFORT;
+        if (a_best_effort != b_best_effort) {
+            return b_best_effort;
+        }
+        return a.getDeadline() < b.getDeadline();
+    }
+
+    bool operator()(const Job& a, const Job& b) const {
+        if (moreUrgent(a, b) || moreUrgent(b, a)) {
+            return moreUrgent(a, b);
+        }
+        if (a.getSloClass() != b.getSloClass()) {
+            return a.getSloClass() < b.getSloClass();
+        }
+        if (a.getArrivalTime() != b.getArrivalTime()) {
+            return a.getArrivalTime() < b.getArrivalTime();
+        }
+        return a.getId() < b.getId();
+    }
+};
+
+// Earliest-Deadline-First policy (preemptive).
+// Jobs run to completion unless a more urgent job (EDFOrder::moreUrgent)
+// arrives. Jobs without a deadline run in arrival order behind the rest.
+class EDFPolicy final : public ISchedulingPolicy {
+public:
+    ~EDFPolicy() override = default;
+
+    Job* getNextJob(std::vector<Job>& ready_queue) override;
+
+    // Indexed heap ordered by EDFOrder. Deadlines are fixed, so the order is stable.
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = HeapReadyQueue<EDFOrder>;
+
+    void onJobCompletion(Job* /*completed_job*/, double /*current_time*/) override {}
+
+    std::string getName() const override { return "EDF"; }
+
+    bool isPreemptive() const override { return true; }
+
+    bool preemptsOnArrival() const override { return true; }
+
+    bool shouldPreempt(const Job& running, const Job& arriving) const override {
+        return EDFOrder::moreUrgent(arriving, running);
+    }
+};
+
+}
+
+#endif
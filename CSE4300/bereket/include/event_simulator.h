@@ -0,0 +1,178 @@
+#ifndef CHRONOS_EVENT_SIMULATOR_H
+#define CHRONOS_EVENT_SIMULATOR_H
+
+#include "admission_control.h"
+#include "cost_model.h"
+#include "io_device.h"
+#include "job.h"
+#include "live_metrics.h"
+#include "power_model.h"
+#include "ready_queue.h"
+#include "scheduling_policy.h"
+#include "scheduler_engine.h"
+#include "topology.h"
+#include "trace_writer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace chronos {
+
+// Discrete-event simulation of the scheduler on a virtual clock.
+// Time jumps from one event to the next instead of sleeping, so a run costs
+// O(events * log(events)) CPU time regardless of how long the jobs are.
+//
+// Policy is the type the simulator calls the policy and its ready queue
+// (Policy::Queue) through. EventSimulator uses the ISchedulingPolicy /
+// ReadyQueue interfaces and runs any policy. Instantiated for a built-in
+// (final) policy, every policy and queue call binds statically and the
+// comparator and slice logic inline into the event loop. The instantiations
+// are in event_simulator.cpp; SchedulerEngine picks one per run.
+template <typename Policy>
+class BasicEventSimulator {
+public:
+    using Queue = typename Policy::Queue;
+
+    // trace: optional sink for arrival/dispatch/slice/completion records
+    // cost: overhead charged to the core on every dispatch
+    // topology: socket layout used for cross-socket migration costs
+    // io_depth: requests the I/O device services at once
+    BasicEventSimulator(Policy& policy, int num_cores, TraceWriter* trace = nullptr,
+                        const CostModel& cost = CostModel(), const Topology& topology = Topology(),
+                        int io_depth = 1);
+
+    // Run jobs (sorted by arrival) to completion and fill in result.completed_jobs,
+    // idle_time, context_switches, preemptions, the cost totals and the I/O
+    // totals. Aggregate metrics are left to the engine. jobs is only read:
+    // each job is copied as it arrives, so concurrent runs can share one set.
+    void run(const std::vector<Job>& jobs, ScheduleResult& result);
+
+    // Update live counters as the run goes (set before run(); may be nullptr)
+    void setLiveMetrics(LiveMetrics* live) { live_ = live; }
+
+    // Screen arrivals before they are queued (set before run(); may be nullptr)
+    void setAdmission(AdmissionController* admission) { admission_ = admission; }
+
+    // Core speeds, DVFS and power draw (set before run(); disabled: every
+    // core runs at speed 1 and result.energy stays empty)
+    void setPower(const PowerConfig& power) { power_ = power; }
+
+private:
+    enum class EventType : std::uint8_t {
+        ARRIVAL,     // Next pending job(s) arrive
+        IO_COMPLETION, // A waiting job's I/O burst is done
+        COMPLETION,  // Running job finishes its CPU burst
+        SLICE_END    // Running job is preempted at the end of its quantum
+    };
+    // A slice cut short by an arrival leaves its COMPLETION/SLICE_END event in
+    // the heap; it is skipped because its seq no longer matches the core's.
+
+    struct Event {
+        double time;
+        EventType type;
+        int core;            // Core the event belongs to (-1 for arrivals; the
+                             // waiting slot for I/O completions)
+        std::uint64_t seq;   // Insertion order, keeps ties deterministic
+    };
+
+    // Min-heap ordering: earliest time first, then arrivals and I/O completions
+    // before completions before slice ends (new arrivals enter the queue ahead
+    // of requeued jobs).
+    struct EventLater {
+        bool operator()(const Event& lhs, const Event& rhs) const {
+            if (lhs.time != rhs.time) {
+                return lhs.time > rhs.time;
+            }
+            if (lhs.type != rhs.type) {
+                return lhs.type > rhs.type;
+            }
+            return lhs.seq > rhs.seq;
+        }
+    };
+
+    struct Core {
+        bool busy = false;
+        Job job{0, 0.0f, 0.0f};
+        float slice = 0.0f;          // Length of the slice currently running
+        float work = 0.0f;           // Work it does (slice x rate)
+        float rate = 1.0f;           // Work per second: core speed x frequency
+        double dispatched = 0.0;     // When the slice started running (after overhead)
+        float remaining = 0.0f;      // Job's remaining work at dispatch
+        std::uint64_t event_seq = 0; // The slice's pending end event
+
+        // Power model only
+        std::size_t level = 0;       // Current DVFS level
+        double busy_since = 0.0;     // When the dispatch began (before overhead)
+        float watts = 0.0f;          // Draw while the slice runs
+        double busy_time = 0.0;      // Total time spent busy
+    };
+
+    void schedule(double time, EventType type, int core);
+    void handleEvent(const Event& event, ScheduleResult& result);
+    void admitArrivals(double now);
+
+    // Move the job (its CPU burst done) to the waiting set for its next I/O
+    // burst, and readmit it to the ready queue once the device finishes
+    void beginIo(Job job, int core_id, double now);
+    void endIo(int slot, double now);
+    void dispatchIdleCores(double now);
+
+    // Run core_id's job (already in core.job) for its next slice
+    void startSlice(int core_id, double now);
+
+    // Idle core the power model places the next job on (the job is in core
+    // first_idle's slot); first_idle when there is no power model
+    int chooseCore(int first_idle, double now) const;
+
+    // DVFS level the governor picks for a slice starting now
+    std::size_t nextLevel() const;
+
+    // Power model: charge the slice ending at `now` on core
+    void chargeSlice(Core& core, double now);
+    void finishEnergy(ScheduleResult& result);
+
+    // Arrival-triggered preemption: cut the slice of the running job the
+    // policy most wants to displace for `arriving`, if any
+    void preemptFor(const Job& arriving, double now);
+
+    Policy& policy_;
+    int num_cores_;
+    TraceWriter* trace_;
+    LiveMetrics* live_ = nullptr;
+    AdmissionController* admission_ = nullptr;
+    CostModel cost_;
+    Topology topology_;
+    CostTotals cost_totals_;
+    PowerConfig power_;
+    EnergyStats energy_;
+    double last_event_ = 0.0;
+
+    const std::vector<Job>* pending_ = nullptr;  // Sorted by arrival time
+    std::size_t next_arrival_ = 0;
+    std::unique_ptr<ReadyQueue> queue_owner_;  // From policy_.createReadyQueue()
+    Queue* ready_queue_ = nullptr;             // The same queue, as Policy::Queue
+    std::vector<Core> cores_;
+
+    struct Waiting {
+        Job job{0, 0.0f, 0.0f};
+        double since = 0.0;          // When the job left its core
+    };
+
+    // Jobs blocked on I/O; freed slots are reused
+    IoDevice device_;
+    std::vector<Waiting> waiting_;
+    std::vector<int> free_waiting_;
+    std::priority_queue<Event, std::vector<Event>, EventLater> events_;
+    std::uint64_t next_seq_ = 0;
+    std::size_t dispatches_ = 0;
+    std::size_t preemptions_ = 0;
+};
+
+using EventSimulator = BasicEventSimulator<ISchedulingPolicy>;
+
+}
+
+#endif
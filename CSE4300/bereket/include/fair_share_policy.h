@@ -0,0 +1,122 @@
+#ifndef CHRONOS_FAIR_SHARE_POLICY_H
+#define CHRONOS_FAIR_SHARE_POLICY_H
+
+#include "job_index.h"
+#include "ready_queue.h"
+#include "scheduling_policy.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+class FairShareReadyQueue;
+
+// Hierarchical fair-share policy: weighted fair queueing across tenants
+// (Job::getTenant), and any other policy inside each tenant.
+// Every tenant gets its own instance of the inner policy and its own inner
+// ready queue. The tenant with the least virtual time (CPU time charged to
+// it / its weight) dispatches next, so backlogged tenants split the cores in
+// proportion to their weights however many jobs each one queues: a tenant
+// that floods the system only delays its own jobs.
+class FairSharePolicy final : public ISchedulingPolicy {
+public:
+    using Factory = std::function<std::unique_ptr<ISchedulingPolicy>()>;
+
+    // One inner policy from make_inner per tenant 0..tenants-1 (and at least
+    // one per weight). weights[t] is tenant t's share; tenants past the list
+    // weigh 1. Jobs of higher tenant ids are scheduled as the last tenant.
+    FairSharePolicy(const Factory& make_inner, int tenants, std::vector<double> weights = {});
+    ~FairSharePolicy() override = default;
+
+    // The inner policy's pick over every tenant's jobs (ScanReadyQueue
+    // fallback: tenants are only isolated by the queue createReadyQueue builds)
+    Job* getNextJob(std::vector<Job>& ready_queue) override;
+
+    // Settles the charge the job's dispatch made against the core time the
+    // slice took, then forwards to the job's tenant's policy
+    void onJobCompletion(Job* completed_job, double current_time) override;
+
+    std::string getName() const override { return "Fair Share (" + inner_.front()->getName() + ")"; }
+    bool isPreemptive() const override { return inner_.front()->isPreemptive(); }
+    float getTimeSlice() const override { return inner_.front()->getTimeSlice(); }
+    float getTimeSlice(const Job& job) const override { return inner(job.getTenant()).getTimeSlice(job); }
+
+    // Arrivals only preempt jobs of their own tenant, as the inner policy decides
+    bool preemptsOnArrival() const override { return inner_.front()->preemptsOnArrival(); }
+    bool shouldPreempt(const Job& running, const Job& arriving) const override;
+
+    // Per-tenant inner queues picked by virtual time: O(backlogged tenants) per pop
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = FairShareReadyQueue;
+
+    int getTenants() const { return static_cast<int>(inner_.size()); }
+    double weightOf(int tenant) const;
+    ISchedulingPolicy& inner(int tenant) const;
+
+private:
+    friend class FairShareReadyQueue;
+
+    // Virtual time a dispatch charged, until its slice ends
+    struct Charge {
+        std::size_t queue = 0;      // Index into refunds_
+        double vtime = 0.0;
+    };
+
+    std::vector<std::unique_ptr<ISchedulingPolicy>> inner_;
+    std::vector<double> weights_;
+
+    // Cores end slices concurrently and, for finished jobs, outside the queue
+    // lock, so charges and the refunds they leave have a lock of their own
+    std::mutex charge_mutex_;
+    JobIndex<Charge> charges_;                 // By job id, jobs on a core
+    std::vector<std::vector<double>> refunds_; // Per queue, per tenant
+};
+
+// Ready queue for FairSharePolicy: one inner-policy queue per tenant, created
+// when the tenant's first job arrives. A pop takes the backlogged tenant with
+// the smallest virtual time (ties: lower tenant id) and charges it the slice
+// the job is due to run, divided by the tenant's weight, so cores picking at
+// the same time spread over the tenants. When the slice ends the policy
+// refunds the difference to the core time it really took (preempted, blocked
+// on I/O, or run on a slower core), and the next pop applies it. A tenant that
+// was idle rejoins at the virtual time of the latest dispatch, so it cannot
+// bank credit while it has nothing to run.
+class FairShareReadyQueue final : public ReadyQueue {
+public:
+    explicit FairShareReadyQueue(FairSharePolicy& policy);
+
+    void push(Job job) override;
+    void requeue(Job job) override;
+    bool pop(Job& out) override;
+    bool remove(int job_id, Job& out) override;
+    bool contains(int job_id) const override;
+    std::size_t size() const override { return size_; }
+
+private:
+    struct Tenant {
+        std::unique_ptr<ReadyQueue> queue;
+        double vtime = 0.0;
+    };
+
+    // The job's tenant, made backlogged if it had nothing queued
+    Tenant& admit(const Job& job);
+    void deactivate(std::size_t active_index);
+    // Applies the tenant's refunds from ended slices; charge_mutex_ held
+    void settle(int tenant);
+
+    FairSharePolicy& policy_;
+    std::size_t index_;             // This queue's refunds in the policy
+    std::vector<Tenant> tenants_;
+    std::vector<int> active_;       // Tenants with queued jobs
+    double clock_ = 0.0;            // Virtual time of the latest dispatch
+    std::size_t size_ = 0;
+};
+
+}
+
+#endif
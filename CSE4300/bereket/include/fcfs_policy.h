@@ -1,22 +1,38 @@
 #ifndef CHRONOS_FCFS_POLICY_H
 #define CHRONOS_FCFS_POLICY_H
 
+#include "heap_ready_queue.h"
 #include "scheduling_policy.h"
 #include <string>
 #include <vector>
 
 namespace chronos {
 
+// Dispatch order: earliest to become ready first (arrival, or return from
+// I/O), tie-break on smaller job_id.
+struct FCFSOrder {
+    bool operator()(const Job& a, const Job& b) const {
+        if (a.getReadyTime() != b.getReadyTime()) {
+            return a.getReadyTime() < b.getReadyTime();
+        }
+        return a.getId() < b.getId();
+    }
+};
+
 class FCFSPolicy final : public ISchedulingPolicy {
 public:
     ~FCFSPolicy() override = default;
 
-    // Selects the job with the earliest arrival time.
+    // Selects the job that became ready earliest (arrival or end of I/O).
     // Tie-breaker: smaller job_id.
     Job* getNextJob(std::vector<Job>& ready_queue) override;
 
+    // Indexed heap ordered by FCFSOrder.
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = HeapReadyQueue<FCFSOrder>;
+
     // FCFS has no special completion handling --> just moves on to the next one.
-    void onJobCompletion(Job* /*completed_job*/, float /*current_time*/) override {}
+    void onJobCompletion(Job* /*completed_job*/, double /*current_time*/) override {}
 
     std::string getName() const override { return "FCFS"; }
 
@@ -0,0 +1,49 @@
+#ifndef CHRONOS_FIFO_READY_QUEUE_H
+#define CHRONOS_FIFO_READY_QUEUE_H
+
+#include "job_index.h"
+#include "ready_queue.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace chronos {
+
+// Intrusive FIFO ready queue for rotation-based policies (Round Robin).
+// Jobs live in a node slab with prev/next links embedded next to them; freed
+// nodes are recycled. The engine's push (new arrival) and requeue (slice
+// expired) calls append at the tail, pop takes the head, and a job id -> node
+// index makes remove-by-id O(1) as well. No per-dispatch rescans, and no
+// per-dispatch allocations once the slab has reached its peak size.
+class FifoReadyQueue final : public ReadyQueue {
+public:
+    void push(Job job) override;
+    bool pop(Job& out) override;
+    bool remove(int job_id, Job& out) override;
+    bool contains(int job_id) const override;
+    std::size_t size() const override { return size_; }
+
+private:
+    static constexpr std::uint32_t NIL = UINT32_MAX;
+
+    struct Node {
+        Job job{0, 0.0f, 0.0f};
+        std::uint32_t prev = NIL;
+        std::uint32_t next = NIL;
+    };
+
+    std::uint32_t allocateNode();
+    void unlink(std::uint32_t node);
+
+    std::vector<Node> nodes_;
+    std::vector<std::uint32_t> free_nodes_;
+    JobIndex<std::uint32_t> index_;   // job id -> node
+    std::uint32_t head_ = NIL;
+    std::uint32_t tail_ = NIL;
+    std::size_t size_ = 0;
+};
+
+}
+
+#endif
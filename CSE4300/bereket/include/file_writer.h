@@ -1,9 +1,12 @@
 #ifndef CHRONOS_FILE_WRITER_H
 #define CHRONOS_FILE_WRITER_H
 
+#include "latency_histogram.h"
 #include "metrics_collector.h"
 #include "scheduling_policy.h"
 
+#include <fstream>
+#include <ostream>
 #include <string>
 
 namespace chronos {
@@ -22,14 +25,38 @@ public:
                                 const ISchedulingPolicy& policy,
                                 const std::string& filename = "output/summary.csv");
     
-    // Write both metrics.csv and summary.csv
+    // Append one row per tenant (jobs, throughput, waiting and turnaround
+    // percentiles) to tenants.csv
+    static bool writeTenantsCSV(const MetricsCollector& metrics,
+                                const ISchedulingPolicy& policy,
+                                const std::string& filename = "output/tenants.csv");
+
+    // Append one row (joules, average power, perf/W, DVFS transitions) to
+    // energy.csv
+    static bool writeEnergyCSV(const MetricsCollector& metrics,
+                               const ISchedulingPolicy& policy,
+                               const std::string& filename = "output/energy.csv");
+
+    // Write both metrics.csv and summary.csv, tenants.csv when the jobs came
+    // from more than one tenant, and energy.csv when the run had a power model
     static bool writeAll(const MetricsCollector& metrics,
                         const ISchedulingPolicy& policy,
                         const std::string& output_dir = "output");
 
+    // Percentile columns (p50, p99, p99.9 of ready, turnaround, response and
+    // slowdown) shared by summary.csv and sweep.csv. The header has a leading comma.
+    static const char* latencyColumnsHeader();
+    static void writeLatencyColumns(std::ostream& os, const LatencyStats& latency);
+
 private:
     // Helper to ensure output directory exists
     static bool ensureDirectoryExists(const std::string& dir_path);
+
+    // Helper: Open a CSV that runs append rows to (compare-all). A new or
+    // empty file, or one whose first line is not header (columns from an
+    // older build), is started over with header.
+    static bool openForAppend(std::ofstream& file, const std::string& filename,
+                              const std::string& header);
 };
 
 }
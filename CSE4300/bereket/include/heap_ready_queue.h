@@ -0,0 +1,120 @@
+#ifndef CHRONOS_HEAP_READY_QUEUE_H
+#define CHRONOS_HEAP_READY_QUEUE_H
+
+#include "job_index.h"
+#include "ready_queue.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace chronos {
+
+// Indexed binary heap ordered by a policy comparator.
+// Order(a, b) returns true when a should be dispatched before b; it must be a
+// strict total order (policies tie-break on job id) so the heap top is exactly
+// the job a linear getNextJob() scan would pick.
+// A job id -> heap slot index makes push, pop and remove-by-id O(log n);
+// neither the heap array nor the index allocates per dispatch.
+template <typename Order>
+class HeapReadyQueue final : public ReadyQueue {
+public:
+    explicit HeapReadyQueue(Order order = Order())
+        : order_(order) {}
+
+    void push(Job job) override {
+        const std::size_t slot = heap_.size();
+        position_.set(job.getId(), slot);
+        heap_.push_back(std::move(job));
+        siftUp(slot);
+    }
+
+    bool pop(Job& out) override {
+        if (heap_.empty()) {
+            return false;
+        }
+        out = std::move(heap_.front());
+        removeAt(0, out.getId());
+        return true;
+    }
+
+    bool remove(int job_id, Job& out) override {
+        const std::size_t* position = position_.find(job_id);
+        if (!position) {
+            return false;
+        }
+        const std::size_t slot = *position;
+        out = std::move(heap_[slot]);
+        removeAt(slot, job_id);
+        return true;
+    }
+
+    bool contains(int job_id) const override {
+        return position_.contains(job_id);
+    }
+
+    std::size_t size() const override { return heap_.size(); }
+
+    // Job that pop() would return, or nullptr if empty
+    const Job* top() const { return heap_.empty() ? nullptr : &heap_.front(); }
+
+private:
+    void removeAt(std::size_t slot, int job_id) {
+        position_.erase(job_id);
+        const std::size_t last = heap_.size() - 1;
+        if (slot != last) {
+            place(slot, std::move(heap_[last]));
+        }
+        heap_.pop_back();
+        if (slot < heap_.size()) {
+            siftDown(slot);
+            siftUp(slot);
+        }
+    }
+
+    void place(std::size_t slot, Job&& job) {
+        position_.set(job.getId(), slot);
+        heap_[slot] = std::move(job);
+    }
+
+    void siftUp(std::size_t slot) {
+        Job job = std::move(heap_[slot]);
+        while (slot > 0) {
+            const std::size_t parent = (slot - 1) / 2;
+            if (!order_(job, heap_[parent])) {
+                break;
+            }
+            place(slot, std::move(heap_[parent]));
+            slot = parent;
+        }
+        place(slot, std::move(job));
+    }
+
+    void siftDown(std::size_t slot) {
+        const std::size_t count = heap_.size();
+        Job job = std::move(heap_[slot]);
+        while (true) {
+            std::size_t child = 2 * slot + 1;
+            if (child >= count) {
+                break;
+            }
+            if (child + 1 < count && order_(heap_[child + 1], heap_[child])) {
+                ++child;
+            }
+            if (!order_(heap_[child], job)) {
+                break;
+            }
+            place(slot, std::move(heap_[child]));
+            slot = child;
+        }
+        place(slot, std::move(job));
+    }
+
+    Order order_;
+    std::vector<Job> heap_;
+    JobIndex<std::size_t> position_;   // job id -> heap slot
+};
+
+}
+
+#endif
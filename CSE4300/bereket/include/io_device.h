@@ -0,0 +1,54 @@
+#ifndef CHRONOS_IO_DEVICE_H
+#define CHRONOS_IO_DEVICE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace chronos {
+
+// Simulated I/O device shared by every job's I/O bursts. Up to `depth`
+// requests are serviced at once; later ones wait in FIFO order for the first
+// free channel. Requests must be submitted in (simulated) time order.
+class IoDevice {
+public:
+    struct Request {
+        double start;    // When service begins (after any queueing)
+        double finish;   // When the I/O completes
+        int channel;     // Channel that serviced it
+    };
+
+    explicit IoDevice(int depth = 1)
+        : free_at_(static_cast<std::size_t>(std::max(1, depth)), 0.0) {}
+
+    // Queue an I/O burst of `length` issued at `time`
+    Request submit(double time, float length) {
+        auto channel = std::min_element(free_at_.begin(), free_at_.end());
+        const double start = std::max(time, *channel);
+        const double finish = start + length;
+        *channel = finish;
+
+        busy_time_ += length;
+        wait_time_ += finish - time;
+        queue_time_ += start - time;
+        ++requests_;
+        return Request{start, finish, static_cast<int>(channel - free_at_.begin())};
+    }
+
+    int depth() const { return static_cast<int>(free_at_.size()); }
+    double busyTime() const { return busy_time_; }    // Channel time spent servicing
+    double waitTime() const { return wait_time_; }    // Job time blocked (queue + service)
+    double queueTime() const { return queue_time_; }  // ... of which waiting for a channel
+    std::size_t requests() const { return requests_; }
+
+private:
+    std::vector<double> free_at_;   // When each channel next becomes free
+    double busy_time_ = 0.0;
+    double wait_time_ = 0.0;
+    double queue_time_ = 0.0;
+    std::size_t requests_ = 0;
+};
+
+}
+
+#endif
@@ -1,13 +1,19 @@
 #ifndef CHRONOS_JOB_H
 #define CHRONOS_JOB_H
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <string>
 #include <iostream>
+#include <vector>
 
 namespace chronos {
 
 // Job execution states
-enum class JobState {
+enum class JobState : std::uint8_t {
     NEW,        // Job is created but has not yet arrived
     READY,      // Job has arrived and is ready to be scheduled
     RUNNING,    // Job is currently executing on a CPU core
@@ -15,32 +21,97 @@ enum class JobState {
     FINISHED    // Job has completed execution
 };
 
+// Service-level class a job was submitted under
+enum class SloClass : std::uint8_t {
+    CRITICAL,       // Latency-critical: tighter deadlines, runs first among equal deadlines
+    STANDARD,       // Default
+    BEST_EFFORT     // No promise: what admission control downgrades to
+};
 
 class Job {
 public:
     // Constructor
-    Job(int id, float arrival_time, float burst_time, int priority = 0);
+    // priority is stored in 16 bits (see below); the loaders reject wider values
+    // Absolute times (arrival, start, finish, ready, deadline) are double so
+    // they keep sub-millisecond resolution over long runs; durations are float
+    Job(int id, double arrival_time, float burst_time, int priority = 0, int tenant = 0);
     
 
     int getId() const { return job_id; }
-    float getArrivalTime() const { return arrival_time; }
+    double getArrivalTime() const { return arrival_time; }
     float getBurstTime() const { return burst_time; }
     float getRemainingTime() const { return remaining_time; }
     int getPriority() const { return priority; }
+    int getTenant() const { return tenant; }
     JobState getState() const { return state; }
-    float getStartTime() const { return start_time; }
-    float getFinishTime() const { return finish_time; }
-    float getWaitingTime() const { return waiting_time; }
-    float getTurnaroundTime() const { return turnaround_time; }
+    double getStartTime() const { return start_time; }
+    double getFinishTime() const { return finish_time; }
+
+    // Derived from the timestamps: 0 until the job has started / finished
+    float getWaitingTime() const {
+        return start_time >= 0.0 && start_time > arrival_time
+                   ? static_cast<float>(start_time - arrival_time) : 0.0f;
+    }
+    float getTurnaroundTime() const {
+        return finish_time >= 0.0 && finish_time > arrival_time
+                   ? static_cast<float>(finish_time - arrival_time) : 0.0f;
+    }
     
 
     void setState(JobState new_state) { state = new_state; }
-    void setStartTime(float time) { start_time = time; }
-    void setFinishTime(float time) { finish_time = time; }
+    void setStartTime(double time) { start_time = time; }
+    void setFinishTime(double time) { finish_time = time; }
     void setRemainingTime(float time) { remaining_time = time; }
-    
-    // Update calculated metrics (waiting and turnaround times)
-    void calculateMetrics();
+    void setTenant(int id) { tenant = static_cast<std::uint16_t>(id); }
+
+    // Absolute time the job should finish by (NO_DEADLINE: none)
+    static constexpr double NO_DEADLINE = std::numeric_limits<double>::infinity();
+    double getDeadline() const { return deadline; }
+    void setDeadline(double time) { deadline = time; }
+    bool hasDeadline() const { return std::isfinite(deadline); }
+    bool missedDeadline() const { return hasDeadline() && finish_time > deadline; }
+
+    SloClass getSloClass() const { return slo_class; }
+    void setSloClass(SloClass slo) { slo_class = slo; }
+
+    // Drop the job to best effort. It keeps its deadline, so a late finish
+    // still counts as a miss, but deadline-aware policies run it last.
+    void downgrade() { slo_class = SloClass::BEST_EFFORT; }
+
+    // Length of the slice the job was last dispatched for (set by the engine)
+    float getLastSlice() const { return last_slice; }
+    void setLastSlice(float slice) { last_slice = slice; }
+
+    // Per-job state owned by the scheduling policy, carried with the job so
+    // policy hooks never need a shared lookup table
+    float getVirtualRuntime() const { return vruntime; }                 // CFS
+    void setVirtualRuntime(float value) { vruntime = value; }
+    std::uint8_t getQueueLevel() const { return queue_level; }           // MLFQ
+    void setQueueLevel(std::uint8_t level) { queue_level = level; }
+
+    // Core and NUMA node the job last ran on (-1 before its first dispatch)
+    int getLastCore() const { return last_core; }
+    void setLastCore(int core) { last_core = static_cast<std::int16_t>(core); }
+    int getLastNode() const { return last_node; }
+    void setLastNode(int node) { last_node = static_cast<std::int8_t>(node); }
+
+    // CPU and I/O bursts, alternating and starting and ending with a CPU burst
+    // (cpu, io, cpu, ...). Burst time becomes the total CPU time and remaining
+    // time the work left in the current CPU burst. A single value clears them.
+    void setBursts(const std::vector<float>& bursts);
+    bool hasIoBursts() const { return bursts_ != nullptr; }
+    const std::vector<float>* getBursts() const { return bursts_.get(); }
+
+    // I/O burst that follows the current CPU burst (0 if the job then finishes)
+    float getPendingIoBurst() const;
+
+    // Move on to the CPU burst after the pending I/O burst
+    void startNextCpuBurst();
+
+    // When the job last entered the ready state: its arrival, or the end of
+    // its most recent I/O burst
+    double getReadyTime() const { return ready_time; }
+    void setReadyTime(double time) { ready_time = time; }
     
     // Print job information to output stream
     void print(std::ostream& os = std::cout) const;
@@ -58,28 +129,52 @@ public:
     
     bool isFinished() const { return state == JobState::FINISHED; }
     
-    bool hasArrived(float current_time) const { return arrival_time <= current_time; }
+    bool hasArrived(double current_time) const { return arrival_time <= current_time; }
 
 private:
     int job_id;              // Unique identifier
-    float arrival_time;      // Time when job arrives in system
     float burst_time;        // Total CPU time required
     float remaining_time;    // Remaining CPU time (for preemptive algorithms)
-    int priority;            // Priority value (higher = more priority)
-    
+    std::int16_t priority;   // Priority value (higher = more priority)
+    std::uint16_t tenant;    // Tenant / cgroup the job belongs to (0 = default),
+                             // sharing priority's word
+
+    double arrival_time;     // Time when job arrives in system
+    double start_time;       // Time when job starts execution
+    double finish_time;      // Time when job completes
+    double ready_time;       // Arrival or end of the last I/O burst
+    double deadline;         // Absolute finish-by time, infinity if none
+    float last_slice;        // Most recent dispatch length
+    float vruntime;          // Weighted CPU time received (CFS)
+
+    // Shared and immutable, so copying a job never copies its bursts
+    std::shared_ptr<const std::vector<float>> bursts_;
+    std::uint16_t burst_index = 0; // Current CPU burst in bursts_
+
     JobState state;          // Current execution state
-    
-    float start_time;        // Time when job starts execution
-    float finish_time;       // Time when job completes
-    
-    // Calculated metrics
-    float waiting_time;      // Time spent waiting (start_time - arrival_time)
-    float turnaround_time;   // Total time in system (finish_time - arrival_time)
+    std::uint8_t queue_level; // Feedback queue level, 0 = highest (MLFQ)
+    std::int16_t last_core;  // Core of the most recent dispatch
+    std::int8_t last_node;   // NUMA node of that core
+    SloClass slo_class;      // Service-level class; the small fields above fill one 8-byte word
 };
 
+// 88 bytes on LP64, with no padding: 16 of id, durations, priority and tenant,
+// 40 of absolute times, 8 of per-slice policy state, the 16-byte bursts_
+// handle and 8 of small fields. A Job is what the ready queues move around,
+// so growing it shows up in every dispatch; check the layout before changing it.
+static_assert(sizeof(void*) != 8 || sizeof(Job) == 88, "Job layout changed; update its size");
+
 // Helper to convert JobState to string
 std::string stateToString(JobState state);
 
+std::string sloClassToString(SloClass slo);
+std::optional<SloClass> stringToSloClass(const std::string& str);
+
+// Range of Job priorities and tenant ids
+constexpr int MIN_JOB_PRIORITY = INT16_MIN;
+constexpr int MAX_JOB_PRIORITY = INT16_MAX;
+constexpr int MAX_TENANT = UINT16_MAX;
+
 } 
 
 #endif
\ No newline at end of file
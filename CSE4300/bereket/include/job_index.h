@@ -0,0 +1,138 @@
+#ifndef CHRONOS_JOB_INDEX_H
+#define CHRONOS_JOB_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace chronos {
+
+// Job id -> Value map for ready queues (heap slot, node handle, tree key).
+// Open addressing in one flat array that only ever grows: once it has held the
+// queue's peak size, set() and erase() never allocate, unlike
+// std::unordered_map's per-entry nodes. Ids are dense in every workload, so an
+// id's home slot is its low bits: a queue of consecutive ids fills consecutive
+// slots, each at its home, and a lookup touches the same cache lines the ids'
+// neighbours do. Robin Hood probing with backward-shift deletion keeps colliding
+// ids (ids a capacity apart) in short, ordered runs that a miss can stop early in.
+template <typename Value>
+class JobIndex {
+public:
+    Value* find(int job_id) {
+        const std::size_t slot = locate(job_id);
+        return slot == NOT_FOUND ? nullptr : &entries_[slot].value;
+    }
+
+    const Value* find(int job_id) const {
+        const std::size_t slot = locate(job_id);
+        return slot == NOT_FOUND ? nullptr : &entries_[slot].value;
+    }
+
+    bool contains(int job_id) const { return locate(job_id) != NOT_FOUND; }
+
+    // Insert, or overwrite the value already stored for job_id
+    void set(int job_id, Value value) {
+        if (Value* existing = find(job_id)) {
+            *existing = std::move(value);
+            return;
+        }
+        if ((size_ + 1) * 2 > entries_.size()) {
+            grow();
+        }
+        insert(Entry{job_id, true, std::move(value)});
+        ++size_;
+    }
+
+    bool erase(int job_id) {
+        std::size_t hole = locate(job_id);
+        if (hole == NOT_FOUND) {
+            return false;
+        }
+
+        // Pull the rest of the run back one slot, up to an empty slot or an
+        // entry already at its home
+        std::size_t next = (hole + 1) & mask_;
+        while (entries_[next].used && distance(next) > 0) {
+            entries_[hole] = std::move(entries_[next]);
+            hole = next;
+            next = (next + 1) & mask_;
+        }
+        entries_[hole].used = false;
+        --size_;
+        return true;
+    }
+
+    std::size_t size() const { return size_; }
+
+private:
+    static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+    static constexpr std::size_t MIN_CAPACITY = 16;
+
+    struct Entry {
+        int key = 0;
+        bool used = false;
+        Value value{};
+    };
+
+    std::size_t home(int job_id) const {
+        return static_cast<std::size_t>(static_cast<std::uint32_t>(job_id)) & mask_;
+    }
+
+    // How far the entry in `slot` sits past its home
+    std::size_t distance(std::size_t slot) const {
+        return (slot - home(entries_[slot].key)) & mask_;
+    }
+
+    std::size_t locate(int job_id) const {
+        if (size_ == 0) {
+            return NOT_FOUND;
+        }
+        std::size_t slot = home(job_id);
+        for (std::size_t probed = 0; entries_[slot].used; ++probed) {
+            if (entries_[slot].key == job_id) {
+                return slot;
+            }
+            if (distance(slot) < probed) {
+                return NOT_FOUND;   // job_id would have displaced this entry
+            }
+            slot = (slot + 1) & mask_;
+        }
+        return NOT_FOUND;
+    }
+
+    // Place an entry that is not in the table, displacing any entry closer to
+    // its home than the incoming one is to its own
+    void insert(Entry entry) {
+        std::size_t slot = home(entry.key);
+        for (std::size_t probed = 0; entries_[slot].used; ++probed) {
+            const std::size_t resident = distance(slot);
+            if (resident < probed) {
+                std::swap(entry, entries_[slot]);
+                probed = resident;
+            }
+            slot = (slot + 1) & mask_;
+        }
+        entries_[slot] = std::move(entry);
+    }
+
+    void grow() {
+        std::vector<Entry> old = std::move(entries_);
+        const std::size_t capacity = old.empty() ? MIN_CAPACITY : old.size() * 2;
+        entries_.assign(capacity, Entry());
+        mask_ = capacity - 1;
+        for (Entry& entry : old) {
+            if (entry.used) {
+                insert(std::move(entry));
+            }
+        }
+    }
+
+    std::vector<Entry> entries_;
+    std::size_t size_ = 0;
+    std::size_t mask_ = 0;
+};
+
+}
+
+#endif
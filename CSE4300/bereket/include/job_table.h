@@ -0,0 +1,81 @@
+#ifndef CHRONOS_JOB_TABLE_H
+#define CHRONOS_JOB_TABLE_H
+
+#include "job.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace chronos {
+
+// Completed jobs stored column by column (structure of arrays).
+// Rows are in completion order; row i of every column is the same job.
+// Waiting and turnaround times are derived from the time columns, so a row
+// costs 47 bytes instead of a full Job, and the aggregate metrics are
+// straight-line reductions over contiguous columns that the compiler can
+// vectorise. Absolute times are double, like Job's.
+class JobTable {
+public:
+    JobTable() = default;
+
+    void reserve(std::size_t count);
+    void clear();
+
+    // Append a finished job (copies its id, inputs and start/finish times)
+    void append(const Job& job);
+
+    // Append every row of another table / one row of another table
+    void append(const JobTable& other);
+    void appendRow(const JobTable& other, std::size_t row);
+
+    std::size_t size() const { return ids_.size(); }
+    bool empty() const { return ids_.empty(); }
+
+    int id(std::size_t row) const { return ids_[row]; }
+    double arrivalTime(std::size_t row) const { return arrival_[row]; }
+    float burstTime(std::size_t row) const { return burst_[row]; }
+    int priority(std::size_t row) const { return priority_[row]; }
+    int tenant(std::size_t row) const { return tenant_[row]; }
+    double deadline(std::size_t row) const { return deadline_[row]; }
+    SloClass sloClass(std::size_t row) const { return static_cast<SloClass>(slo_[row]); }
+    double startTime(std::size_t row) const { return start_[row]; }
+    double finishTime(std::size_t row) const { return finish_[row]; }
+    float waitingTime(std::size_t row) const;
+    float turnaroundTime(std::size_t row) const;
+
+    // Column access for bulk processing
+    const std::vector<double>& arrivalTimes() const { return arrival_; }
+    const std::vector<float>& burstTimes() const { return burst_; }
+    const std::vector<double>& startTimes() const { return start_; }
+    const std::vector<double>& finishTimes() const { return finish_; }
+    const std::vector<std::uint16_t>& tenants() const { return tenant_; }
+
+    // Rebuild row as a finished Job (for printing)
+    Job toJob(std::size_t row) const;
+
+    // Column reductions
+    double totalWaitingTime() const;
+    double totalTurnaroundTime() const;
+    double totalBurstTime() const;
+    double earliestStart() const;   // 0 when empty
+    double latestFinish() const;    // 0 when empty
+    std::size_t deadlineJobs() const;       // Rows with a deadline
+    std::size_t deadlineMisses() const;     // ... that finished after it
+    bool hasSloInfo() const;                // Any deadline or non-standard class
+
+private:
+    std::vector<std::int32_t> ids_;
+    std::vector<double> arrival_;
+    std::vector<float> burst_;
+    std::vector<std::int32_t> priority_;
+    std::vector<std::uint16_t> tenant_;
+    std::vector<double> deadline_;
+    std::vector<std::uint8_t> slo_;
+    std::vector<double> start_;
+    std::vector<double> finish_;
+};
+
+}
+
+#endif
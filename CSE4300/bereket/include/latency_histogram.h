@@ -0,0 +1,73 @@
+#ifndef CHRONOS_LATENCY_HISTOGRAM_H
+#define CHRONOS_LATENCY_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace chronos {
+
+// HDR-style log-linear histogram of non-negative values.
+// Values are counted in units of `resolution`; below 256 units every unit has
+// its own bucket, above that each power of two is split into 128 buckets, so
+// any recorded value is reported within 0.4% (or half a unit). Recording is
+// O(1), and histograms with the same resolution merge by adding counts.
+class LatencyHistogram {
+public:
+    explicit LatencyHistogram(double resolution = 1e-4);
+
+    void record(double value);
+
+    // Add another histogram's counts (resolutions must match)
+    bool merge(const LatencyHistogram& other);
+
+    // Take out the counts of an earlier copy of this histogram, leaving what
+    // was recorded since. min() and max() narrow to the remaining buckets.
+    bool subtract(const LatencyHistogram& earlier);
+
+    void reset();
+
+    std::uint64_t count() const { return total_; }
+    double min() const { return total_ ? min_ : 0.0; }
+    double max() const { return total_ ? max_ : 0.0; }
+    double mean() const { return total_ ? sum_ / static_cast<double>(total_) : 0.0; }
+    double getResolution() const { return resolution_; }
+
+    // Value at percentile p (0-100); 0 when empty
+    double percentile(double p) const;
+
+private:
+    static constexpr int SUB_BUCKET_BITS = 8;
+    static constexpr std::uint64_t SUB_BUCKETS = 1ULL << SUB_BUCKET_BITS;   // 256
+    static constexpr std::uint64_t HALF_BUCKETS = SUB_BUCKETS / 2;          // 128
+
+    static std::size_t indexOf(std::uint64_t units);
+    static std::uint64_t lowestUnits(std::size_t index);
+    static std::uint64_t bucketWidth(std::size_t index);
+
+    double resolution_;
+    std::vector<std::uint64_t> counts_;     // Grown on demand up to the largest index seen
+    std::uint64_t total_ = 0;
+    double sum_ = 0.0;
+    double min_ = 0.0;
+    double max_ = 0.0;
+};
+
+// Per-job latency distributions of one run (or of several merged runs)
+struct LatencyStats {
+    // "Waiting" elsewhere (avg_waiting_time, Job::getWaitingTime) is start -
+    // arrival, the response histogram below; this one also counts the time
+    // a preempted or I/O-returning job sits ready between slices
+    LatencyHistogram ready;                 // Time spent ready: turnaround - burst
+    LatencyHistogram turnaround;            // finish - arrival
+    LatencyHistogram response;              // First dispatch - arrival
+    LatencyHistogram slowdown{1e-3};        // turnaround / burst (dimensionless)
+
+    void record(double arrival, float burst, double start, double finish);
+    void merge(const LatencyStats& other);
+    void reset();
+};
+
+}
+
+#endif
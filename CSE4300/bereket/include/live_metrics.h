@@ -0,0 +1,127 @@
+#ifndef CHRONOS_LIVE_METRICS_H
+#define CHRONOS_LIVE_METRICS_H
+
+#include "latency_histogram.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace chronos {
+
+// Point-in-time copy of a run's live counters (LiveMetrics::snapshot)
+struct LiveSnapshot {
+    std::uint64_t run = 0;                  // Bumped by every LiveMetrics::begin()
+    std::string label;                      // Policy name
+    bool running = false;
+    double sim_time = 0.0;                  // Furthest simulated time any core reached
+    std::size_t queue_depth = 0;
+    std::uint64_t dispatches = 0;
+    std::uint64_t completed = 0;
+    std::vector<double> busy;               // Per core: simulated time spent on slices
+    LatencyHistogram turnaround;            // All cores, as last published by each
+};
+
+// Counters an engine run updates as it goes, for StatsPublisher to read.
+// Each core writes only its own cache line, with relaxed atomic loads and
+// stores (no locks, no read-modify-write), so a reader never stalls a core.
+// A snapshot sees every counter whole but not all of them at one instant,
+// which is fine for estimates refreshed every second or so.
+// Turnaround times go into each core's own LatencyHistogram. A snapshot asks
+// every core for a copy, which the core makes at its next completion, and
+// merges the copies made since the previous snapshot; end() publishes them all.
+class LiveMetrics {
+public:
+    // Start a new run (before its threads start); end() it after they stop
+    void begin(const std::string& label, int num_cores);
+    void end();
+
+    // Hot path. `core` is the only writer of its counters.
+    void recordSlice(int core, double start, double length);
+    void recordCompletion(int core, double turnaround);
+
+    // Single writer: the event loop, or the threaded engine's scheduler thread
+    void setQueueDepth(std::size_t depth) { queue_depth_.store(depth, std::memory_order_relaxed); }
+
+    LiveSnapshot snapshot() const;
+
+private:
+    struct alignas(64) CoreCounters {
+        std::atomic<double> busy{0.0};
+        std::atomic<double> clock{0.0};
+        std::atomic<std::uint64_t> dispatches{0};
+        std::atomic<std::uint64_t> completed{0};
+        LatencyHistogram turnaround;                  // Written only by the core
+        std::atomic<bool> copy_wanted{false};         // Set by snapshot()
+        std::mutex copy_mutex;                        // Guards published
+        LatencyHistogram published;                   // The core's latest copy
+    };
+
+    // Copy a core's histogram for snapshot(). Its writer, or nobody, is running.
+    static void publish(CoreCounters& counters);
+
+    // Guards the core array against begin()/end(), never taken by the hot path
+    mutable std::mutex mutex_;
+    std::unique_ptr<CoreCounters[]> cores_;
+    int num_cores_ = 0;
+    std::uint64_t run_ = 0;
+    std::string label_;
+    bool running_ = false;
+    std::atomic<std::size_t> queue_depth_{0};
+};
+
+// Background thread that snapshots a LiveMetrics every interval and writes
+// one JSON object per line to stderr or to every client of a Unix stream
+// socket. Rates, utilisation and turnaround quantiles cover a sliding window
+// of the last `window` snapshots of the current run.
+class StatsPublisher {
+public:
+    StatsPublisher(const LiveMetrics& metrics, std::chrono::milliseconds interval,
+                   std::size_t window = 10);
+    ~StatsPublisher();
+
+    // target: "stderr" or "unix:PATH" (PATH is replaced if it exists).
+    // Returns false (with a message on std::cerr) if the socket cannot be opened.
+    bool start(const std::string& target);
+
+    // Publish a final record, then stop the thread and close the socket
+    void stop();
+
+private:
+    struct Sample {
+        std::chrono::steady_clock::time_point at;
+        LiveSnapshot snapshot;
+    };
+
+    void run();
+    void publish();
+    std::string format(const Sample& newest, const Sample& oldest) const;
+    void send(const std::string& line);
+
+    const LiveMetrics& metrics_;
+    std::chrono::milliseconds interval_;
+    std::size_t window_;
+    std::chrono::steady_clock::time_point started_;
+    std::deque<Sample> samples_;
+
+    std::string socket_path_;
+    int listen_fd_ = -1;
+    std::vector<int> clients_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
+
+}
+
+#endif
@@ -2,19 +2,44 @@
 #define CHRONOS_METRICS_COLLECTOR_H
 
 #include "job.h"
+#include "job_table.h"
+#include "latency_histogram.h"
+#include "power_model.h"
 
+#include <atomic>
 #include <cstddef>
 #include <mutex>
 #include <vector>
 
 namespace chronos {
 
+// One tenant's completed jobs (MetricsCollector::tenantBreakdown)
+struct TenantMetrics {
+    int tenant = 0;
+    std::size_t jobs = 0;
+    double cpu_time = 0.0;          // Sum of the jobs' CPU bursts
+    double total_waiting = 0.0;
+    double total_turnaround = 0.0;
+    float throughput = 0.0f;        // Jobs per second of the run's makespan
+    LatencyStats latency;
+
+    float averageWaitingTime() const {
+        return jobs ? static_cast<float>(total_waiting / static_cast<double>(jobs)) : 0.0f;
+    }
+    float averageTurnaroundTime() const {
+        return jobs ? static_cast<float>(total_turnaround / static_cast<double>(jobs)) : 0.0f;
+    }
+};
+
 // Collects and aggregates scheduling performance metrics
 class MetricsCollector {
 public:
     MetricsCollector();
     
     void recordJobCompletion(const Job& job);
+
+    // Take over a whole run's completed jobs (e.g. ScheduleResult::completed_jobs)
+    void setCompletedJobs(JobTable jobs);
     
     void recordCpuActivity(float duration);
     
@@ -30,12 +55,21 @@ public:
     void setContextSwitches(std::size_t switches);
     
     void setNumCores(int cores);
+
+    // Energy a run drew (ScheduleResult::energy; not enabled without a power model)
+    void setEnergy(const EnergyStats& energy) { energy_ = energy; }
+    const EnergyStats& getEnergy() const { return energy_; }
     
-    const std::vector<Job>& getCompletedJobs() const { return completed_jobs_; }
+    // In completion order, not id order
+    const JobTable& getCompletedJobs() const { return completed_jobs_; }
+
+    // Latency distributions of the completed jobs (updated on every record)
+    const LatencyStats& getLatencyStats() const { return latency_; }
     
-    float getTotalWaitingTime() const { return total_waiting_time_; }
+    // Column reductions over the completed jobs
+    float getTotalWaitingTime() const;
     
-    float getTotalTurnaroundTime() const { return total_turnaround_time_; }
+    float getTotalTurnaroundTime() const;
     
     float getAverageWaitingTime() const;
     
@@ -58,25 +92,41 @@ public:
     float getTotalCpuActiveTime() const { return cpu_active_time_; }
     
     float getTotalIdleTime() const { return idle_time_; }
+
+    // Completed jobs per joule (0 without a power model)
+    double getPerfPerWatt() const;
     
+    // Completed jobs grouped by tenant, in tenant order (tenants without jobs
+    // are left out); computed on demand, so recording costs nothing extra
+    std::vector<TenantMetrics> getTenantMetrics() const { return tenantBreakdown(completed_jobs_, makespan_); }
+    static std::vector<TenantMetrics> tenantBreakdown(const JobTable& jobs, float makespan);
+
+    // Number of distinct tenants among the completed jobs
+    std::size_t getTenantCount() const;
+
     // Reset all metrics (for reuse)
     void reset();
     
-    // Thread-safe version of recordJobCompletion (for multithreaded use)
+    // Thread-safe version of recordJobCompletion (for multithreaded use).
+    // Takes a lock per job: hot paths should fill one collector per thread
+    // and merge() them at the end instead.
     void recordJobCompletionThreadSafe(const Job& job);
     
-    // Thread-safe version of recordContextSwitch
+    // Thread-safe version of recordContextSwitch (a relaxed atomic increment)
     void recordContextSwitchThreadSafe();
 
+    // Fold another (e.g. per-thread) collector's jobs, histograms and counters into this one
+    void merge(const MetricsCollector& other);
+
 private:
-    std::vector<Job> completed_jobs_;
-    float total_waiting_time_;
-    float total_turnaround_time_;
+    JobTable completed_jobs_;       // Completion order (merge() appends)
+    LatencyStats latency_;
     float cpu_active_time_;
     float idle_time_;
     float makespan_;
     int num_cores_;
-    std::size_t dispatch_count_;
+    EnergyStats energy_;
+    std::atomic<std::size_t> dispatch_count_;
     
     mutable std::mutex metrics_mutex_;
     
@@ -0,0 +1,83 @@
+#ifndef CHRONOS_MLFQ_POLICY_H
+#define CHRONOS_MLFQ_POLICY_H
+
+#include "fifo_ready_queue.h"
+#include "scheduling_policy.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+class MLFQReadyQueue;
+
+// Multi-level feedback queue (preemptive).
+// New jobs enter level 0. A job that uses its whole quantum drops one level;
+// level i runs with quantum base * 2^i, so long jobs sink to long, rare slices
+// while short and interactive jobs stay on top. Every boost_interval seconds
+// all queued jobs are moved back to level 0 so sunk jobs cannot starve.
+// The job's level travels with it (Job::getQueueLevel), so hooks are lock-free.
+class MLFQPolicy final : public ISchedulingPolicy {
+public:
+    // boost_interval <= 0 picks 20 base quanta
+    explicit MLFQPolicy(int base_quantum, int levels = 3, float boost_interval = 0.0f);
+    ~MLFQPolicy() override = default;
+
+    // Highest level first, then earliest arrival (ScanReadyQueue fallback)
+    Job* getNextJob(std::vector<Job>& ready_queue) override;
+
+    // Demote a job that used its full quantum; advance the boost clock
+    void onJobCompletion(Job* completed_job, double current_time) override;
+
+    std::string getName() const override { return "MLFQ"; }
+    bool isPreemptive() const override { return true; }
+
+    // Level-0 quantum; per-job slices grow with the job's level
+    float getTimeSlice() const override { return quantum(0); }
+    float getTimeSlice(const Job& job) const override { return quantum(job.getQueueLevel()); }
+
+    int getLevels() const { return levels_; }
+    float getBoostInterval() const { return boost_interval_; }
+    float quantum(int level) const;
+
+    // Number of boost periods that have started so far
+    std::uint64_t boostEpoch() const { return boost_epoch_.load(std::memory_order_acquire); }
+
+    // One FIFO per level: push, pop and requeue are O(levels)
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = MLFQReadyQueue;
+
+private:
+    int base_quantum_;
+    int levels_;
+    float boost_interval_;
+    std::atomic<std::uint64_t> boost_epoch_{0};
+};
+
+// Ready queue for MLFQPolicy: one intrusive FIFO per level.
+// When the policy's boost epoch moves on, every lower level is drained into
+// level 0 (in level order) before the next push or pop.
+class MLFQReadyQueue final : public ReadyQueue {
+public:
+    explicit MLFQReadyQueue(const MLFQPolicy& policy);
+
+    void push(Job job) override;
+    bool pop(Job& out) override;
+    bool remove(int job_id, Job& out) override;
+    bool contains(int job_id) const override;
+    std::size_t size() const override { return size_; }
+
+private:
+    void boostIfDue();
+
+    const MLFQPolicy& policy_;
+    std::vector<FifoReadyQueue> levels_;
+    std::uint64_t seen_epoch_ = 0;
+    std::size_t size_ = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef CHRONOS_NODE_POOL_H
+#define CHRONOS_NODE_POOL_H
+
+#include <cstddef>
+#include <new>
+
+namespace chronos {
+
+// Recycles the nodes of one node-based container (std::map, std::list).
+// Freed nodes go on a free list and are handed out again, so a container
+// whose size stays bounded stops allocating once it has reached its peak.
+// Not thread-safe: the container's own lock covers it.
+class NodePool {
+public:
+    NodePool() = default;
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        while (free_) {
+            FreeNode* next = free_->next;
+            ::operator delete(free_);
+            free_ = next;
+        }
+    }
+
+    // The first size requested becomes the pooled node size; anything else
+    // (a rebound allocator's bookkeeping) goes straight to the heap
+    void* allocate(std::size_t size) {
+        if (node_size_ == 0 && size >= sizeof(FreeNode)) {
+            node_size_ = size;
+        }
+        if (size != node_size_ || !free_) {
+            return ::operator new(size);
+        }
+        FreeNode* node = free_;
+        free_ = node->next;
+        return node;
+    }
+
+    void deallocate(void* ptr, std::size_t size) {
+        if (size != node_size_) {
+            ::operator delete(ptr);
+            return;
+        }
+        free_ = new (ptr) FreeNode{free_};
+    }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    FreeNode* free_ = nullptr;
+    std::size_t node_size_ = 0;
+};
+
+// Allocator handing single nodes out of a NodePool (arrays bypass it)
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(NodePool& pool) noexcept
+        : pool_(&pool) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept
+        : pool_(other.pool()) {}
+
+    T* allocate(std::size_t count) {
+        if (count == 1) {
+            return static_cast<T*>(pool_->allocate(sizeof(T)));
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept {
+        if (count == 1) {
+            pool_->deallocate(ptr, sizeof(T));
+        } else {
+            ::operator delete(ptr);
+        }
+    }
+
+    NodePool* pool() const noexcept { return pool_; }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept { return pool_ == other.pool(); }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const noexcept { return pool_ != other.pool(); }
+
+private:
+    NodePool* pool_;
+};
+
+}
+
+#endif
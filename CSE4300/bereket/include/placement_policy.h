@@ -0,0 +1,116 @@
+#ifndef CHRONOS_PLACEMENT_POLICY_H
+#define CHRONOS_PLACEMENT_POLICY_H
+
+#include "job.h"
+#include "topology.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// Built-in strategies for distributing jobs across per-core run queues
+enum class PlacementStrategy {
+    ROUND_ROBIN,    // Cycle through cores in order
+    LEAST_LOADED,   // Core with the shortest run queue
+    SOFT_AFFINITY,  // Least loaded on arrival; requeue on the last core unless it is overloaded
+    HARD_AFFINITY,  // Least loaded on arrival, then pinned there: no requeue elsewhere, no stealing
+    NUMA_LOCAL      // Keep jobs (requeues and steals) on their NUMA node first
+};
+
+// Chooses which core's run queue receives a job: arrivals, requeues after an
+// expired slice, and steals by idle cores. requeueJob() and stealFrom() are
+// called concurrently from worker threads and must not modify the policy.
+class PlacementPolicy {
+public:
+    virtual ~PlacementPolicy() = default;
+
+    // queue_lengths: current length of every core's run queue (may be slightly stale)
+    // Returns: core index in [0, queue_lengths.size())
+    virtual int placeJob(const Job& job, const std::vector<std::size_t>& queue_lengths) = 0;
+
+    // Run queue for a job whose slice expired (job.getLastCore() is the core
+    // it just ran on). Default: stay on that core.
+    virtual int requeueJob(const Job& job, const std::vector<std::size_t>& queue_lengths) const;
+
+    // Core an idle thief_core should steal from, or -1 to stay idle.
+    // Default: the busiest other core.
+    virtual int stealFrom(int thief_core, const std::vector<std::size_t>& queue_lengths) const;
+
+    // False if idle cores must never take work from other cores' queues
+    virtual bool allowsStealing() const { return true; }
+
+    virtual std::string getName() const = 0;
+};
+
+class RoundRobinPlacement final : public PlacementPolicy {
+public:
+    int placeJob(const Job& job, const std::vector<std::size_t>& queue_lengths) override;
+    std::string getName() const override { return "Round Robin"; }
+
+private:
+    std::size_t next_core_ = 0;
+};
+
+class LeastLoadedPlacement final : public PlacementPolicy {
+public:
+    int placeJob(const Job& job, const std::vector<std::size_t>& queue_lengths) override;
+    std::string getName() const override { return "Least Loaded"; }
+};
+
+// Least loaded on arrival (ties rotate across cores). A requeued job goes back to its last core unless
+// that queue is more than MAX_IMBALANCE jobs longer than the shortest queue
+// on the same node, in which case it moves to that shorter queue.
+class SoftAffinityPlacement final : public PlacementPolicy {
+public:
+    static constexpr std::size_t MAX_IMBALANCE = 2;
+
+    explicit SoftAffinityPlacement(const Topology& topology)
+        : topology_(topology) {}
+
+    int placeJob(const Job& job, const std::vector<std::size_t>& queue_lengths) override;
+    int requeueJob(const Job& job, const std::vector<std::size_t>& queue_lengths) const override;
+    std::string getName() const override { return "Soft Affinity"; }
+
+private:
+    Topology topology_;
+    std::size_t next_core_ = 0;     // Rotates arrival ties across cores
+};
+
+// Least loaded on arrival; from then on the job only ever runs on that core
+class HardAffinityPlacement final : public PlacementPolicy {
+public:
+    int placeJob(const Job& job, const std::vector<std::size_t>& queue_lengths) override;
+    bool allowsStealing() const override { return false; }
+    std::string getName() const override { return "Hard Affinity"; }
+
+private:
+    std::size_t next_core_ = 0;     // Rotates arrival ties across cores
+};
+
+// Least loaded on arrival. Requeues go to the shortest queue on the job's
+// node (its last core on ties), and idle cores steal from their own node
+// before reaching across sockets.
+class NumaLocalPlacement final : public PlacementPolicy {
+public:
+    explicit NumaLocalPlacement(const Topology& topology)
+        : topology_(topology) {}
+
+    int placeJob(const Job& job, const std::vector<std::size_t>& queue_lengths) override;
+    int requeueJob(const Job& job, const std::vector<std::size_t>& queue_lengths) const override;
+    int stealFrom(int thief_core, const std::vector<std::size_t>& queue_lengths) const override;
+    std::string getName() const override { return "NUMA Local"; }
+
+private:
+    Topology topology_;
+    std::size_t next_core_ = 0;     // Rotates arrival ties across cores
+};
+
+std::unique_ptr<PlacementPolicy> createPlacementPolicy(PlacementStrategy strategy,
+                                                       const Topology& topology = Topology());
+
+}
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef CHRONOS_POWER_MODEL_H
+#define CHRONOS_POWER_MODEL_H
+
+#include "job.h"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// Speed and power draw of one kind of core
+struct CoreType {
+    std::string name = "big";
+    float speed = 1.0f;             // Work per second at full frequency (1 = a reference core)
+    float active_watts = 3.0f;      // Draw while running at full frequency
+    float idle_watts = 0.3f;        // Draw while idle, at any frequency
+
+    static CoreType big() { return CoreType(); }
+    static CoreType little() { return CoreType{"little", 0.5f, 0.6f, 0.05f}; }
+
+    // Joules per second of reference work while running at frequency
+    float joulesPerWork(float frequency = 1.0f) const;
+};
+
+// How a core picks its frequency for each slice
+enum class Governor {
+    PERFORMANCE,    // Always the highest level
+    POWERSAVE,      // Always the lowest level
+    ONDEMAND        // The lowest level covering the load (running + queued jobs per core)
+};
+
+// Which idle core the event engine hands the next job to
+enum class EnergyPlacement {
+    IN_ORDER,       // Lowest-numbered idle core (the engine's usual order)
+    FASTEST,        // Highest speed
+    EFFICIENT,      // Fewest joules per unit of work
+    ENERGY_AWARE    // Most efficient core that still meets the job's deadline, else the fastest
+};
+
+// Heterogeneous cores with DVFS (event engine). Running at frequency f (a
+// fraction of full) does speed x f work per second and draws
+// idle + (active - idle) x f^3 watts: the dynamic part scales with f V^2, and
+// voltage with f. Every core is always on and draws its idle power when idle.
+struct PowerConfig {
+    // Core i's type; cores past the list take the last one. Empty: no power model.
+    std::vector<CoreType> cores;
+
+    // DVFS levels as fractions of full frequency, ascending, ending at 1
+    std::vector<float> frequencies = {1.0f};
+    Governor governor = Governor::PERFORMANCE;
+    float transition_latency = 0.0f;    // Seconds a core stalls to change frequency
+
+    EnergyPlacement placement = EnergyPlacement::IN_ORDER;
+
+    bool enabled() const { return !cores.empty(); }
+
+    const CoreType& coreType(int core_id) const;
+
+    // Draw of a core of type running at frequency
+    static float activePower(const CoreType& type, float frequency);
+
+    // Index into frequencies for a slice starting with `running` cores busy
+    // (this one included) and `queued` jobs waiting on num_cores cores
+    std::size_t pickLevel(int running, std::size_t queued, int num_cores) const;
+};
+
+// Energy a run consumed (ScheduleResult::energy); all zero without a power model
+struct EnergyStats {
+    bool enabled = false;
+    double active_joules = 0.0;     // Running, switching and changing frequency
+    double idle_joules = 0.0;
+    double run_time = 0.0;          // Core seconds spent running jobs
+    double busy_time = 0.0;         // ... plus switch overhead and DVFS stalls
+    double duration = 0.0;          // First arrival to the last event
+    std::size_t transitions = 0;    // DVFS frequency changes
+    double transition_time = 0.0;   // Core seconds stalled by them
+
+    double joules() const { return active_joules + idle_joules; }
+    double averagePower() const { return duration > 0.0 ? joules() / duration : 0.0; }
+};
+
+std::string governorToString(Governor governor);
+std::optional<Governor> stringToGovernor(const std::string& str);
+std::string energyPlacementToString(EnergyPlacement placement);
+std::optional<EnergyPlacement> stringToEnergyPlacement(const std::string& str);
+
+// "2xbig,4xlittle": the core types, big and little presets or
+// SPEED:ACTIVE_W:IDLE_W, each COUNTx... (one core when the count is left out)
+std::string coreTypesToString(const std::vector<CoreType>& cores);
+
+}
+
+#endif
@@ -1,12 +1,26 @@
 #ifndef CHRONOS_PRIORITY_POLICY_H
 #define CHRONOS_PRIORITY_POLICY_H
 
+#include "heap_ready_queue.h"
 #include "scheduling_policy.h"
 #include <string>
 #include <vector>
 
 namespace chronos {
 
+// Dispatch order: higher priority first, tie-break on earlier arrival, then smaller job id.
+struct PriorityOrder {
+    bool operator()(const Job& a, const Job& b) const {
+        if (a.getPriority() != b.getPriority()) {
+            return a.getPriority() > b.getPriority();
+        }
+        if (a.getArrivalTime() != b.getArrivalTime()) {
+            return a.getArrivalTime() < b.getArrivalTime();
+        }
+        return a.getId() < b.getId();
+    }
+};
+
 // Priority-based scheduling policy (non-preemptive).
 // Higher numeric priority wins and ties are broken by arrival time, then job id.
 class PriorityPolicy final : public ISchedulingPolicy {
@@ -15,14 +29,43 @@ public:
 
     Job* getNextJob(std::vector<Job>& ready_queue) override;
 
+    // Indexed heap ordered by PriorityOrder.
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = HeapReadyQueue<PriorityOrder>;
+
     // Non-preemptive
-    void onJobCompletion(Job* , float /*current_time*/) override {}
+    void onJobCompletion(Job* , double /*current_time*/) override {}
 
     std::string getName() const override { return "Priority"; }
 
     bool isPreemptive() const override { return false; }
 };
 
+// Preemptive priority: same order as PriorityPolicy, but a job that arrives
+// with a strictly higher priority than a running one takes its core.
+class PreemptivePriorityPolicy final : public ISchedulingPolicy {
+public:
+    ~PreemptivePriorityPolicy() override = default;
+
+    Job* getNextJob(std::vector<Job>& ready_queue) override;
+
+    // Indexed heap ordered by PriorityOrder.
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = HeapReadyQueue<PriorityOrder>;
+
+    void onJobCompletion(Job* , double /*current_time*/) override {}
+
+    std::string getName() const override { return "Preemptive Priority"; }
+
+    bool isPreemptive() const override { return true; }
+
+    bool preemptsOnArrival() const override { return true; }
+
+    bool shouldPreempt(const Job& running, const Job& arriving) const override {
+        return arriving.getPriority() > running.getPriority();
+    }
+};
+
 } 
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef CHRONOS_READY_QUEUE_H
+#define CHRONOS_READY_QUEUE_H
+
+#include "job.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace chronos {
+
+class ISchedulingPolicy;
+
+// Storage for jobs that have arrived and are waiting for a core.
+// Each policy creates the queue that suits it (see ISchedulingPolicy::createReadyQueue)
+// and the engine only talks to it through this interface.
+class ReadyQueue {
+public:
+    virtual ~ReadyQueue() = default;
+
+    // Admit a newly arrived job
+    virtual void push(Job job) = 0;
+
+    // Return a job whose slice expired but still has work left
+    virtual void requeue(Job job) { push(std::move(job)); }
+
+    // Remove the job the policy would dispatch next.
+    // Returns false if the queue is empty.
+    virtual bool pop(Job& out) = 0;
+
+    // Remove the next (up to) k jobs in dispatch order, appending them to out.
+    // Returns the number removed. Default: k pops.
+    virtual std::size_t popBatch(std::size_t k, std::vector<Job>& out);
+
+    // Remove a specific job. Returns false if it is not queued.
+    virtual bool remove(int job_id, Job& out) = 0;
+
+    virtual bool contains(int job_id) const = 0;
+
+    virtual std::size_t size() const = 0;
+
+    bool empty() const { return size() == 0; }
+};
+
+// Fallback queue for policies that only implement getNextJob().
+// Keeps jobs in a vector and asks the policy to scan it on every pop (O(n)).
+class ScanReadyQueue final : public ReadyQueue {
+public:
+    explicit ScanReadyQueue(ISchedulingPolicy& policy);
+
+    void push(Job job) override;
+    bool pop(Job& out) override;
+    std::size_t popBatch(std::size_t k, std::vector<Job>& out) override;
+    bool remove(int job_id, Job& out) override;
+    bool contains(int job_id) const override;
+    std::size_t size() const override { return jobs_.size(); }
+
+private:
+    ISchedulingPolicy& policy_;
+    std::vector<Job> jobs_;
+};
+
+}
+
+#endif
@@ -1,8 +1,8 @@
 #ifndef CHRONOS_RR_POLICY_H
 #define CHRONOS_RR_POLICY_H
 
+#include "fifo_ready_queue.h"
 #include "scheduling_policy.h"
-#include <deque>
 #include <string>
 #include <vector>
 
@@ -10,27 +10,34 @@ namespace chronos {
 
 // Round-Robin scheduling policy (preemptive).
 // Jobs share CPU time in a fixed quantum and unfinished jobs are re-queued.
+// The rotation is the ready queue itself: new arrivals and expired slices are
+// appended at the tail and the head is dispatched next, so a pick is O(1).
 class RoundRobinPolicy final : public ISchedulingPolicy {
 public:
     explicit RoundRobinPolicy(int quantum);
     ~RoundRobinPolicy() override = default;
 
+    // Returns the head of the queue. ScanReadyQueue keeps the vector in
+    // enqueue order (arrivals and requeues are appended), so the front is next.
     Job* getNextJob(std::vector<Job>& ready_queue) override;
-    void onJobCompletion(Job* completed_job, float current_time) override;
+
+    // Requeueing is done by the engine through ReadyQueue::requeue().
+    void onJobCompletion(Job* /*completed_job*/, double /*current_time*/) override {}
 
     std::string getName() const override { return "Round Robin"; }
     bool isPreemptive() const override { return true; }
+    using ISchedulingPolicy::getTimeSlice;
     float getTimeSlice() const override { return static_cast<float>(quantum_); }
     int getQuantum() const { return quantum_; }
 
+    // Intrusive FIFO: enqueue, requeue and dispatch are all O(1).
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = FifoReadyQueue;
+
 private:
     int quantum_;
-    std::deque<int> rotation_;                 // job ids in rotation order
-
-    void syncRotationWithReadyQueue(const std::vector<Job>& ready_queue);
-    bool containsJob(int job_id) const;
 };
 
 } 
 
-#endif
\ No newline at end of file
+#endif
@@ -1,23 +1,102 @@
 #ifndef CHRONOS_SCHEDULER_ENGINE_H
 #define CHRONOS_SCHEDULER_ENGINE_H
 
+#include "admission_control.h"
+#include "cost_model.h"
+#include "cpu_kernel.h"
+#include "dispatch_log.h"
 #include "job.h"
+#include "job_table.h"
+#include "latency_histogram.h"
+#include "live_metrics.h"
+#include "placement_policy.h"
+#include "power_model.h"
+#include "ready_queue.h"
 #include "scheduling_policy.h"
+#include "topology.h"
+#include "trace_writer.h"
+#include "worker_pool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <limits>
 #include <mutex>
 #include <thread>
 #include <vector>
 
 namespace chronos {
 
-// Forward declaration
-class WorkerPool;
+// How the engine advances simulated time
+enum class EngineMode {
+    THREADED,        // Worker threads sleep through each slice (1 simulated second = 1 s)
+    DISCRETE_EVENT   // Virtual clock driven by an event queue, no sleeping
+};
+
+// How the event engine calls the policy and its ready queue
+enum class DispatchMode {
+    STATIC,     // Built-in policies run on a simulator compiled for their concrete
+                // type, so policy and queue calls inline (others fall back to VIRTUAL)
+    VIRTUAL     // Every call through ISchedulingPolicy / ReadyQueue
+};
+
+// Engine settings chosen once per run (usually from CLIOptions)
+struct EngineConfig {
+    EngineMode mode = EngineMode::THREADED;
+
+    // THREADED mode: one shared ready queue or per-core run queues with stealing
+    QueueMode queue_mode = QueueMode::GLOBAL;
+    PlacementStrategy placement = PlacementStrategy::ROUND_ROBIN;
+
+    // Switch and migration costs charged on every dispatch
+    CostModel cost;
+
+    // DISCRETE_EVENT mode: statically dispatched simulator for built-in policies
+    DispatchMode dispatch = DispatchMode::STATIC;
+
+    // Sockets / NUMA nodes the cores are grouped into
+    Topology topology;
+
+    // I/O requests the simulated device services at once (jobs with I/O bursts)
+    int io_depth = 1;
+
+    // Print aggregate metrics after each run
+    bool print_summary = true;
+
+    // ... and the per-job table when the run completed at most this many jobs
+    std::size_t job_table_rows = 50;
+
+    // THREADED mode: time worker-side ready-queue lock holds (ScheduleResult::queue_locks)
+    bool profile_locks = false;
+
+    // THREADED mode: sleep through slices, or run a real CPU kernel on pinned
+    // threads and measure it (ScheduleResult::execution)
+    ExecutionConfig execution;
+
+    // THREADED mode: cores, I/O and arrivals take turns in simulated-time
+    // order, so the same jobs always get the same schedule (GLOBAL queue only)
+    bool deterministic = false;
+
+    // Deterministic THREADED mode: records every dispatch, checking each one
+    // against a loaded log if there is one (nullptr: none)
+    DispatchLog* dispatch_log = nullptr;
+
+    // Live counters both engines update during each run, for a StatsPublisher
+    // (nullptr: none). Not shared between concurrent runs.
+    LiveMetrics* live = nullptr;
+
+    // Both engines: screen every arrival before it is queued (a fresh
+    // controller per run)
+    AdmissionConfig admission;
+
+    // DISCRETE_EVENT mode: per-core speeds, DVFS levels and power draw
+    // (empty core list: identical full-speed cores, no energy accounting)
+    PowerConfig power;
+};
 
 struct ScheduleResult {
-    std::vector<Job> completed_jobs;
+    JobTable completed_jobs;            // Completion order
     float total_waiting_time = 0.0f;
     float total_turnaround_time = 0.0f;
     float cpu_active_time = 0.0f;
@@ -26,6 +105,25 @@ struct ScheduleResult {
     int num_cores = 1;
     std::size_t dispatch_count = 0;
     std::size_t context_switches = 0;
+    std::size_t preemptions = 0;        // Slices cut short by an arriving job
+    std::size_t migrations = 0;         // Dispatches onto a different core than last time
+    std::size_t remote_migrations = 0;  // ... of which crossed to another socket
+    float switch_overhead_time = 0.0f;  // Core time spent on dispatch overhead
+    float warmup_time = 0.0f;           // Core time spent warming caches after migrations
+    std::size_t stolen_jobs = 0;        // Work-stealing transfers (per-core queues)
+    std::size_t io_requests = 0;        // I/O bursts serviced by the device
+    float io_wait_time = 0.0f;          // Job time blocked on I/O (queueing + service)
+    float io_queue_time = 0.0f;         // ... of which waiting for a free device channel
+    float device_busy_time = 0.0f;      // Channel time spent servicing I/O
+    int io_depth = 1;
+    LatencyStats latency;               // Waiting/turnaround/response/slowdown distributions
+    LockStats queue_locks;              // Ready-queue lock holds (EngineConfig::profile_locks)
+    ExecutionStats execution;           // Measured kernel time (EngineConfig::execution)
+    AdmissionStats admission;           // Arrivals rejected or downgraded (EngineConfig::admission)
+    std::size_t deadline_jobs = 0;      // Completed or rejected jobs that had a deadline
+    std::size_t deadline_misses = 0;    // ... of which finished after it or were rejected
+    float goodput = 0.0f;               // On-time completions per second of makespan
+    EnergyStats energy;                 // Joules drawn (EngineConfig::power)
 
     float averageWaitingTime() const {
         return completed_jobs.empty()
@@ -47,6 +145,25 @@ struct ScheduleResult {
         return std::min(1.0f, cpu_active_time / (makespan * static_cast<float>(num_cores)));
     }
 
+    float deviceUtilization() const {
+        if (makespan <= 0.0f || io_depth <= 0) {
+            return 0.0f;
+        }
+        return std::min(1.0f, device_busy_time / (makespan * static_cast<float>(io_depth)));
+    }
+
+    float deadlineMissRate() const {
+        return deadline_jobs == 0
+                   ? 0.0f
+                   : static_cast<float>(deadline_misses) / static_cast<float>(deadline_jobs);
+    }
+
+    // Completed jobs per joule: throughput per watt of average power
+    double perfPerWatt() const {
+        const double joules = energy.joules();
+        return joules > 0.0 ? static_cast<double>(completed_jobs.size()) / joules : 0.0;
+    }
+
     std::size_t contextSwitches() const {
         return context_switches;
     }
@@ -54,28 +171,67 @@ struct ScheduleResult {
 
 class SchedulerEngine {
 public:
-    // Run jobs using multithreaded worker pool
-    ScheduleResult run(std::vector<Job> jobs, ISchedulingPolicy& policy, int num_cores);
+    explicit SchedulerEngine(EngineMode mode = EngineMode::THREADED);
+    explicit SchedulerEngine(const EngineConfig& config);
+
+    // Run jobs using the configured engine (worker pool or event simulation)
+    ScheduleResult run(std::vector<Job>&& jobs, ISchedulingPolicy& policy, int num_cores);
+
+    // Run a job set the caller keeps, e.g. one shared by concurrent runs. If
+    // it is sorted by arrival (sortByArrival), the event engine copies each
+    // job as it arrives instead of the whole set up front.
+    ScheduleResult run(const std::vector<Job>& jobs, ISchedulingPolicy& policy, int num_cores);
+
+    // The order both engines admit jobs in: arrival time, then id
+    static void sortByArrival(std::vector<Job>& jobs);
+
+    // Stream scheduling events of later runs to trace (nullptr disables tracing).
+    // The writer must stay open until run() returns.
+    void setTraceWriter(TraceWriter* trace) { trace_ = trace; }
+
+    EngineMode getMode() const { return config_.mode; }
+    const EngineConfig& getConfig() const { return config_; }
 
     // Print a summary table and aggregate metrics.
     void printSummary(const ScheduleResult& result, const ISchedulingPolicy& policy) const;
 
 private:
-    void printJobTable(const std::vector<Job>& jobs) const;
+    EngineConfig config_;
+    TraceWriter* trace_ = nullptr;
+
+    void printJobTable(const JobTable& jobs) const;
+
+    // Per-tenant throughput and latency, when the jobs came from several tenants
+    void printTenants(const ScheduleResult& result) const;
+
+    // Joules, average power and DVFS activity of a run with a power model
+    void printEnergy(const ScheduleResult& result) const;
+
+    // Measured against predicted timings of a real-execution run
+    void printExecution(const ScheduleResult& result) const;
+
+    // jobs sorted by arrival; owned is the same vector when the engine may
+    // consume it (nullptr: the caller's, copied where a run needs its own)
+    ScheduleResult runSorted(const std::vector<Job>& jobs, std::vector<Job>* owned,
+                             ISchedulingPolicy& policy, int num_cores);
+
+    // Run jobs on the event simulator (instantiated for the policy's
+    // concrete type when config_.dispatch is STATIC and it is built in)
+    void runEventDriven(const std::vector<Job>& jobs, ISchedulingPolicy& policy, int num_cores,
+                        AdmissionController* admission, ScheduleResult& result);
+
+    // Run jobs on the multithreaded worker pool
+    void runThreaded(std::vector<Job> jobs, ISchedulingPolicy& policy, int num_cores,
+                     AdmissionController* admission, ScheduleResult& result);
+
+    // Fill in aggregate metrics from result.completed_jobs
+    void aggregateMetrics(ScheduleResult& result, double simulation_start) const;
     
-    // Scheduler thread function - dispatches jobs to ready queue
-    void schedulerThread(std::vector<Job> jobs, ISchedulingPolicy& policy, 
-                       std::vector<Job>& ready_queue,
-                       std::mutex& queue_mutex,
-                       std::condition_variable& job_available,
+    // Scheduler thread function - admits arriving jobs to the worker pool
+    void schedulerThread(std::vector<Job> jobs,
                        std::atomic<bool>& simulation_running,
                        ScheduleResult& result,
                        WorkerPool& worker_pool);
-    
-    // Collect completed jobs from ready queue
-    void collectCompletedJobs(std::vector<Job>& ready_queue, 
-                            std::vector<Job>& completed_jobs,
-                            std::mutex& queue_mutex);
 };
 
 }
@@ -2,11 +2,14 @@
 #define CHRONOS_SCHEDULING_POLICY_H
 
 #include "job.h"
+#include <cstddef>
 #include <vector>
 #include <memory>
 
 namespace chronos {
 
+class ReadyQueue;
+
 // Defines the interface that all scheduling algorithms must implement (Abstract base class)
 class ISchedulingPolicy {
 public:
@@ -16,11 +19,20 @@ public:
     // Returns: pointer to the selected job, or nullptr if no job is available
     // Note: The policy should not remove the job from the queue; that's the scheduler's responsibility
     virtual Job* getNextJob(std::vector<Job>& ready_queue) = 0;
+
+    // Move the next (up to) k jobs, in dispatch order, from ready_queue to the
+    // end of out, so one queue lock can fill several idle cores. Returns the
+    // number moved. Only ScanReadyQueue calls it: policies with their own
+    // queue implement ReadyQueue::popBatch() instead. Default: k getNextJob() scans.
+    virtual std::size_t pickBatch(std::vector<Job>& ready_queue, std::size_t k,
+                                  std::vector<Job>& out);
     
 
     // current_time: current simulation time
     // Note: For preemptive algorithms (like RR), this may need to re-queue the job
-    virtual void onJobCompletion(Job* completed_job, float current_time) = 0;
+    // Threaded engine: called under the ready-queue lock only for a job that
+    // is requeued; for a finished or blocking job, cores call it concurrently
+    virtual void onJobCompletion(Job* completed_job, double current_time) = 0;
     
     // Get the name of the scheduling policy (for logging/output)
     virtual std::string getName() const = 0;
@@ -31,6 +43,28 @@ public:
 
     // Optional time slice (seconds). Negative ⇒ run job to completion.
     virtual float getTimeSlice() const { return -1.0f; }
+
+    // Time slice for dispatching this particular job. Engines call this one;
+    // adaptive policies (MLFQ levels, CFS weights) override it. Called outside
+    // any queue lock, so it may only read the job and thread-safe state.
+    virtual float getTimeSlice(const Job& /*job*/) const { return getTimeSlice(); }
+
+    // Arrival-triggered preemption. Engines only look at running jobs when
+    // preemptsOnArrival() is true; shouldPreempt() then decides whether
+    // `arriving` may cut `running`'s slice short. `running` carries the work
+    // it still has left at the arrival instant. Called outside any queue lock.
+    virtual bool preemptsOnArrival() const { return false; }
+    virtual bool shouldPreempt(const Job& /*running*/, const Job& /*arriving*/) const { return false; }
+
+    // Create the ready queue the engine should use with this policy.
+    // Default: a vector scanned with getNextJob() on every dispatch (O(n)).
+    // Comparator policies override this with an indexed heap (O(log n)).
+    virtual std::unique_ptr<ReadyQueue> createReadyQueue();
+
+    // The type createReadyQueue() returns. Built-in policies redeclare it as
+    // their concrete queue, so an engine instantiated for the policy type
+    // (BasicEventSimulator<Policy>) calls both without virtual dispatch.
+    using Queue = ReadyQueue;
 };
 
 }
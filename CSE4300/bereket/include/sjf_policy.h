@@ -1,12 +1,26 @@
 #ifndef CHRONOS_SJF_POLICY_H
 #define CHRONOS_SJF_POLICY_H
 
+#include "heap_ready_queue.h"
 #include "scheduling_policy.h"
 #include <string>
 #include <vector>
 
 namespace chronos {
 
+// Dispatch order: smallest burst first, tie-break on arrival time, then job id.
+struct SJFOrder {
+    bool operator()(const Job& a, const Job& b) const {
+        if (a.getBurstTime() != b.getBurstTime()) {
+            return a.getBurstTime() < b.getBurstTime();
+        }
+        if (a.getArrivalTime() != b.getArrivalTime()) {
+            return a.getArrivalTime() < b.getArrivalTime();
+        }
+        return a.getId() < b.getId();
+    }
+};
+
 // Shortest-Job-First policy (non-preemptive)
 class SJFPolicy final : public ISchedulingPolicy {
 public:
@@ -15,8 +29,12 @@ public:
     // Pick job with the smallest burst time -->  tie-break by arrival, then job id.
     Job* getNextJob(std::vector<Job>& ready_queue) override;
 
+    // Indexed heap ordered by SJFOrder.
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = HeapReadyQueue<SJFOrder>;
+
     // SJF is non-preemptive
-    void onJobCompletion(Job* /*completed_job*/, float /*current_time*/) override {}
+    void onJobCompletion(Job* /*completed_job*/, double /*current_time*/) override {}
 
     std::string getName() const override { return "SJF"; }
 
@@ -0,0 +1,53 @@
+#ifndef CHRONOS_SRTF_POLICY_H
+#define CHRONOS_SRTF_POLICY_H
+
+#include "heap_ready_queue.h"
+#include "scheduling_policy.h"
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// Dispatch order: least remaining work first, tie-break on arrival time, then job id.
+// Queued jobs do not run, so their remaining time (and the heap order) is stable.
+struct SRTFOrder {
+    bool operator()(const Job& a, const Job& b) const {
+        if (a.getRemainingTime() != b.getRemainingTime()) {
+            return a.getRemainingTime() < b.getRemainingTime();
+        }
+        if (a.getArrivalTime() != b.getArrivalTime()) {
+            return a.getArrivalTime() < b.getArrivalTime();
+        }
+        return a.getId() < b.getId();
+    }
+};
+
+// Shortest-Remaining-Time-First policy (preemptive SJF).
+// Jobs run to completion unless a job arrives with less work left than a
+// running one, in which case the running job goes back to the ready queue.
+class SRTFPolicy final : public ISchedulingPolicy {
+public:
+    ~SRTFPolicy() override = default;
+
+    Job* getNextJob(std::vector<Job>& ready_queue) override;
+
+    // Indexed heap ordered by SRTFOrder.
+    std::unique_ptr<ReadyQueue> createReadyQueue() override;
+    using Queue = HeapReadyQueue<SRTFOrder>;
+
+    void onJobCompletion(Job* /*completed_job*/, double /*current_time*/) override {}
+
+    std::string getName() const override { return "SRTF"; }
+
+    bool isPreemptive() const override { return true; }
+
+    bool preemptsOnArrival() const override { return true; }
+
+    bool shouldPreempt(const Job& running, const Job& arriving) const override {
+        return arriving.getRemainingTime() < running.getRemainingTime();
+    }
+};
+
+}
+
+#endif
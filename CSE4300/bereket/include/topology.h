@@ -0,0 +1,26 @@
+#ifndef CHRONOS_TOPOLOGY_H
+#define CHRONOS_TOPOLOGY_H
+
+#include <algorithm>
+
+namespace chronos {
+
+// Simulated machine layout. Cores are split evenly, in index order, across
+// sockets; each socket is one NUMA node (cores 0..k-1 on node 0, and so on).
+struct Topology {
+    int sockets = 1;
+
+    int coresPerSocket(int num_cores) const {
+        const int per_socket = (num_cores + std::max(1, sockets) - 1) / std::max(1, sockets);
+        return std::max(1, per_socket);
+    }
+
+    // NUMA node of core_id on a machine with num_cores cores
+    int nodeOf(int core_id, int num_cores) const {
+        return std::min(core_id / coresPerSocket(num_cores), std::max(1, sockets) - 1);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef CHRONOS_TRACE_WRITER_H
+#define CHRONOS_TRACE_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// Scheduling events captured in a binary trace
+enum class TraceEventType : std::uint8_t {
+    ARRIVAL = 0,     // value = burst time, aux = priority
+    DISPATCH = 1,    // value = slice length, aux = 1 on the job's first dispatch
+    SLICE_END = 2,   // value = remaining time after the slice (job requeued),
+                     // aux = 1 when an arrival preempted the slice
+    COMPLETION = 3,  // value = turnaround time
+    IO_START = 4,    // Job leaves its core for an I/O burst; value = I/O length,
+                     // aux = device channel
+    IO_END = 5       // I/O burst done, job ready again; value = time blocked
+};
+
+// Fixed-width trace record (24 bytes, host byte order)
+struct TraceRecord {
+    double time;            // Simulated time of the event (seconds)
+    std::int32_t job_id;
+    std::int16_t core;      // -1 when the event is not tied to a core
+    std::uint8_t type;      // TraceEventType
+    std::uint8_t reserved;
+    float value;            // Meaning depends on type (see TraceEventType)
+    std::int32_t aux;
+};
+static_assert(sizeof(TraceRecord) == 24, "TraceRecord must stay 24 bytes");
+
+// File header (64 bytes). record_count is patched in when the trace is closed.
+struct TraceHeader {
+    char magic[8];          // "CHRTRACE"
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t record_count;
+    char algorithm[40];     // NUL-padded policy name
+};
+static_assert(sizeof(TraceHeader) == 64, "TraceHeader must stay 64 bytes");
+
+// Streams scheduling events to a binary columnar-friendly trace file.
+// Records are appended to an in-memory buffer that is flushed in large writes,
+// or, with use_mmap, written straight into a memory-mapped view of the file.
+// Not thread-safe: callers on several threads must serialise record().
+// tools/trace_to_csv.py converts a trace back to metrics.csv.
+class TraceWriter {
+public:
+    static constexpr std::uint32_t VERSION = 1;
+
+    TraceWriter();
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    // Returns false if the file cannot be created
+    bool open(const std::string& path, const std::string& algorithm, bool use_mmap = false);
+
+    void record(TraceEventType type, double time, int job_id, int core,
+                float value, std::int32_t aux = 0) {
+        TraceRecord* slot = nextSlot();
+        if (!slot) {
+            return;
+        }
+        slot->time = time;
+        slot->job_id = job_id;
+        slot->core = static_cast<std::int16_t>(core);
+        slot->type = static_cast<std::uint8_t>(type);
+        slot->reserved = 0;
+        slot->value = value;
+        slot->aux = aux;
+        ++record_count_;
+    }
+
+    // Flush remaining records, patch the header and close the file
+    bool close();
+
+    bool isOpen() const { return file_ != nullptr || map_fd_ >= 0; }
+    bool isMemoryMapped() const { return map_fd_ >= 0; }
+    std::uint64_t getRecordCount() const { return record_count_; }
+
+private:
+    TraceRecord* nextSlot() {
+        if (buffer_used_ < buffer_.size()) {
+            return &buffer_[buffer_used_++];
+        }
+        if (map_base_ && map_used_ < map_capacity_) {
+            return &map_base_[map_used_++];
+        }
+        return acquireSlot();
+    }
+
+    // Slow path: flush the buffer or grow the mapping, then hand out a slot
+    TraceRecord* acquireSlot();
+    bool flushBuffer();
+    bool growMapping();
+    void fillHeader(TraceHeader& header) const;
+
+    std::FILE* file_ = nullptr;
+    std::vector<TraceRecord> buffer_;
+    std::size_t buffer_used_ = 0;
+
+    int map_fd_ = -1;
+    void* map_addr_ = nullptr;              // Start of the mapping (header included)
+    std::size_t map_length_ = 0;
+    TraceRecord* map_base_ = nullptr;       // First record slot (just past the header)
+    std::size_t map_capacity_ = 0;          // Record slots currently mapped
+    std::size_t map_used_ = 0;
+
+    std::string path_;
+    std::string algorithm_;
+    std::uint64_t record_count_ = 0;
+    bool failed_ = false;
+};
+
+}
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef CHRONOS_TURN_SEQUENCER_H
+#define CHRONOS_TURN_SEQUENCER_H
+
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace chronos {
+
+// Lets a fixed set of threads ("actors") act one at a time in simulated-time
+// order, so a multithreaded run takes the same decisions in the same order
+// every time it runs. Each actor says when it next needs a turn; the earliest
+// (time, phase, actor) goes next. Whatever an actor does between wait() and
+// pass() is serialised with every other actor's turn, while work outside its
+// turn (sleeping through a slice) overlaps freely.
+class TurnSequencer {
+public:
+    // At equal times every RELEASE turn (a slice ending, I/O completing, jobs
+    // arriving) comes before any ACQUIRE turn (a core picking its next job)
+    enum class Phase : int { RELEASE = 0, ACQUIRE = 1 };
+
+    // An actor with no turn pending, until another one schedule()s it
+    static constexpr double IDLE = std::numeric_limits<double>::infinity();
+
+    explicit TurnSequencer(int actors);
+
+    // Set an actor's next turn: before begin(), or from the turn holder
+    // (which may only schedule times >= now())
+    void schedule(int actor, double time, Phase phase);
+
+    // Hand out the first turn
+    void begin();
+
+    // Block until `actor` holds the turn. Returns false once no actor has a
+    // turn pending, which ends the run.
+    bool wait(int actor);
+
+    // End the holder's turn; it acts again at (time, phase), or only once
+    // another actor schedules it when time is IDLE
+    void pass(int actor, double time = IDLE, Phase phase = Phase::RELEASE);
+
+    // Simulated time of the current turn
+    double now() const;
+
+private:
+    struct Actor {
+        double time = IDLE;
+        Phase phase = Phase::RELEASE;
+        std::condition_variable turn;
+    };
+
+    // Actor with the earliest pending turn, -1 if none. Caller holds mutex_.
+    int next() const;
+
+    // Give the turn to next(), or end the run. Caller holds mutex_.
+    void advance();
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Actor>> actors_;
+    int current_ = -1;
+    double now_ = 0.0;
+    bool finished_ = false;
+};
+
+}
+
+#endif
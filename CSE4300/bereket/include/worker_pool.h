@@ -1,67 +1,391 @@
 #ifndef CHRONOS_WORKER_POOL_H
 #define CHRONOS_WORKER_POOL_H
 
+#include "admission_control.h"
+#include "cost_model.h"
+#include "cpu_kernel.h"
+#include "dispatch_log.h"
+#include "io_device.h"
 #include "job.h"
+#include "job_table.h"
+#include "live_metrics.h"
+#include "placement_policy.h"
+#include "ready_queue.h"
 #include "scheduling_policy.h"
+#include "topology.h"
+#include "trace_writer.h"
+#include "turn_sequencer.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
 
 namespace chronos {
 
+// How ready jobs are shared between worker threads
+enum class QueueMode {
+    GLOBAL,     // One ready queue and one mutex shared by every core
+    PER_CORE    // One run queue per core; idle cores steal from the busiest peer
+};
+
+// How long worker threads hold ready-queue locks (WorkerPool::setLockProfiling):
+// popping the next job, and reporting / requeueing it after its slice
+struct LockStats {
+    std::size_t acquisitions = 0;
+    double total_ns = 0.0;
+    double max_ns = 0.0;
+
+    void record(double ns) {
+        ++acquisitions;
+        total_ns += ns;
+        max_ns = std::max(max_ns, ns);
+    }
+
+    void merge(const LockStats& other) {
+        acquisitions += other.acquisitions;
+        total_ns += other.total_ns;
+        max_ns = std::max(max_ns, other.max_ns);
+    }
+
+    double meanNs() const {
+        return acquisitions == 0 ? 0.0 : total_ns / static_cast<double>(acquisitions);
+    }
+};
+
 // Manages worker threads that simulate CPU cores executing jobs
 class WorkerPool {
 public:
-    WorkerPool(int num_cores, ISchedulingPolicy& policy, 
-               std::vector<Job>& ready_queue,
+    WorkerPool(int num_cores, ISchedulingPolicy& policy,
+               ReadyQueue& ready_queue,
                std::mutex& queue_mutex,
                std::condition_variable& job_available,
                std::atomic<bool>& simulation_running,
-               std::vector<Job>& completed_jobs,
-               std::mutex& completed_mutex,
-               std::atomic<size_t>& context_switches);
-    
+               JobTable& completed_jobs,
+               std::atomic<size_t>& context_switches,
+               QueueMode queue_mode = QueueMode::GLOBAL,
+               std::unique_ptr<PlacementPolicy> placement = nullptr);
+
     ~WorkerPool();
-    
+
     // Start all worker threads
     void start();
-    
-    // Stop all worker threads (wait for completion)
+
+    // Stop all worker threads (wait for completion), then merge the per-core
+    // completion buffers into completed_jobs and add up the dispatch counters
     void stop();
-    
+
+    // Hand a newly arrived job to the workers (called from the scheduler thread)
+    void submit(Job job);
+
+    // Hand over jobs[first, last), all arriving at the same instant. In GLOBAL
+    // mode without preemption they are queued, and handed to every idle core,
+    // under one queue lock; otherwise each is submit()ted in turn.
+    void submitBatch(std::vector<Job>& jobs, std::size_t first, std::size_t last);
+
+    // Wake every waiting worker (after simulation_running is cleared)
+    void notifyAll();
+
+    // Deterministic mode (set before start(); GLOBAL queue only). The cores,
+    // the I/O thread and the scheduler thread's arrivals take turns in
+    // simulated-time order (TurnSequencer), so every pop, requeue, preemption
+    // and I/O completion happens in the same order on every run, whichever
+    // thread the OS wakes first. Slices still sleep (or run kernels) side by side.
+    void setDeterministic(bool enabled) { deterministic_ = enabled; }
+    bool isDeterministic() const { return deterministic_; }
+
+    // Deterministic mode: record every dispatch (set before start(); may be nullptr)
+    void setDispatchLog(DispatchLog* log) { dispatch_log_ = log; }
+
+    // Deterministic mode, from the scheduler thread: admit arrival-sorted
+    // jobs, each instant's batch in its own turn. Returns once every job has
+    // finished.
+    void admitInTurns(std::vector<Job>& jobs);
+
+    // Record scheduling events to a trace (set before start(); may be nullptr)
+    void setTraceWriter(TraceWriter* trace) { trace_ = trace; }
+
+    // Update live counters from each core (set before start(); may be nullptr)
+    void setLiveMetrics(LiveMetrics* live) { live_ = live; }
+
+    // Screen arrivals in submitBatch() before they are queued (set before
+    // start(); may be nullptr). Only the scheduler thread calls it.
+    void setAdmission(AdmissionController* admission) { admission_ = admission; }
+
+    // Charge switch and migration costs on every dispatch (set before start())
+    void setCostModel(const CostModel& cost) { cost_ = cost; }
+
+    // Socket layout for migration costs (set before start(); the placement
+    // policy gets its own copy when it is created)
+    void setTopology(const Topology& topology) { topology_ = topology; }
+
+    // Overhead charged by all cores; complete once stop() has returned
+    CostTotals costTotals() const;
+
+    // Service jobs' I/O bursts on a device with `depth` channels, from a
+    // separate I/O thread (set before start(), only needed for such jobs)
+    void enableIo(int depth);
+
+    // I/O totals; complete once stop() has returned
+    const IoDevice& ioDevice() const { return device_; }
+
+    // Time every worker-side ready-queue lock hold (set before start()).
+    // Costs two clock reads per hold, so it is off by default.
+    void setLockProfiling(bool enabled) { profile_locks_ = enabled; }
+
+    // Hold times of all cores; complete once stop() has returned
+    LockStats lockStats() const;
+
+    // Run a real CPU kernel for each slice instead of sleeping (set before
+    // start(), which calibrates the kernel on the calling thread)
+    void setExecution(const ExecutionConfig& execution) { execution_ = execution; }
+
+    // Measured kernel time of all cores; complete once stop() has returned
+    ExecutionStats executionStats() const;
+
+    // Size each core's completion buffer for its share of `jobs` (set before
+    // start()), so no worker reallocates one mid-run
+    void reserveCompletions(std::size_t jobs);
+
     // Get number of active workers
     int getNumCores() const { return num_cores_; }
-    
+
+    QueueMode getQueueMode() const { return queue_mode_; }
+
+    // Jobs waiting in the ready queue(s)
+    std::size_t queuedJobs() const { return queued_jobs_.load(); }
+
+    // Jobs submitted but not yet finished (queued, running or blocked on I/O)
+    std::size_t outstandingJobs() const { return outstanding_jobs_.load(); }
+
+    // Number of jobs taken from another core's run queue (PER_CORE mode)
+    std::size_t stolenJobs() const { return stolen_jobs_.load(); }
+
+    // Slices cut short by an arriving job (policies with preemptsOnArrival())
+    std::size_t preemptions() const { return preemptions_.load(); }
+
     // Check if all workers are idle
     bool allIdle() const;
 
 private:
+    // State written only by one worker thread, so completions and dispatch
+    // counting take no shared lock or atomic. Cache-line aligned to keep
+    // neighbouring cores from false sharing.
+    struct alignas(64) WorkerLocal {
+        JobTable completed;          // Finished jobs in this core's finish-time order
+        std::size_t dispatches = 0;
+        CostTotals costs;
+        LockStats locks;
+        std::vector<std::size_t> queue_lengths;   // Scratch for requeue/steal placement
+        ExecutionStats execution;
+        std::unique_ptr<CpuKernel> kernel;        // Real execution only
+    };
+
+    // What a core is running, so submit() can interrupt it. Only allocated
+    // for policies that preempt on arrival.
+    struct CoreSlot {
+        std::mutex mutex;
+        std::condition_variable preempted;
+        bool running = false;
+        Job job{0, 0.0f, 0.0f};      // Snapshot at dispatch
+        double run_start = 0.0;      // When the slice starts running (after overhead)
+        float execution = 0.0f;      // Planned slice length
+        double preempt_at = -1.0;    // Simulated time the slice is cut at (< 0: not cut)
+        std::atomic<bool> cut{false};  // Set with preempt_at; polled by a running kernel
+    };
+
+    // A job blocked on I/O, readmitted once the wall clock reaches `due`
+    struct Blocked {
+        std::chrono::steady_clock::time_point due;
+        double since = 0.0;          // Simulated time the job left its core
+        double ready_time = 0.0;     // Simulated time its I/O completes
+        Job job{0, 0.0f, 0.0f};
+    };
+    struct BlockedLater {
+        bool simulated = false;      // Deterministic mode: by completion time, then job id
+
+        bool operator()(const Blocked& lhs, const Blocked& rhs) const {
+            if (!simulated) {
+                return lhs.due > rhs.due;
+            }
+            if (lhs.ready_time != rhs.ready_time) {
+                return lhs.ready_time > rhs.ready_time;
+            }
+            return lhs.job.getId() > rhs.job.getId();
+        }
+    };
+
+    // GLOBAL mode: an idle core parks on its own slot rather than the shared
+    // condition variable. Whoever queues work fills every parked core from
+    // one popBatch() under the queue lock it already holds, so a burst that
+    // reaches N idle cores costs one lock hold instead of N wake-ups that
+    // each retake the lock to pop a job.
+    struct Handoff {
+        std::mutex mutex;
+        std::condition_variable ready;
+        bool has_job = false;
+        Job job{0, 0.0f, 0.0f};
+    };
+
+    // Per-core run queue used in PER_CORE mode
+    struct RunQueue {
+        std::unique_ptr<ReadyQueue> queue;
+        std::mutex mutex;
+        std::condition_variable job_available;
+        std::atomic<std::size_t> length{0};
+    };
+
     // Worker thread function - simulates CPU core execution
     void workerThread(int core_id);
-    
-    // Execute a job on a CPU core (simulated by sleeping)
-    void executeJob(Job& job, float time_slice, int core_id);
-    
+
+    // Queue a ready job (new arrival or back from I/O), preempting a running
+    // job for it if the policy asks to
+    void enqueue(Job job, bool arrival);
+
+    // Hand a job whose CPU burst ended at `now` to the I/O device
+    void beginIo(int core_id, Job job, double now);
+
+    // I/O thread: readmits blocked jobs as their I/O completes
+    void ioThread();
+
+    // Queue a job whose I/O is done (from the I/O thread)
+    void readmit(Blocked& done);
+
+    // Deterministic mode: turn-sequencer actors after the cores
+    int ioActor() const { return num_cores_; }
+    int arrivalActor() const { return num_cores_ + 1; }
+
+    // Deterministic mode: wait for this core's turn and pop its next job,
+    // parking the core until a push schedules it again while the queue is
+    // empty. now is set to the simulated time of the turn.
+    bool acquireInTurn(int core_id, Job& job, double& now);
+
+    // Deterministic I/O thread: readmit each blocked job in its completion's turn
+    void ioInTurns();
+
+    // Run jobs[first, last) past admission_, moving the admitted ones to the
+    // front of the range. Returns the end of the admitted jobs.
+    std::size_t screenArrivals(std::vector<Job>& jobs, std::size_t first, std::size_t last);
+
+    // Pop jobs for as many parked cores as possible and hand them over.
+    // Caller holds queue_mutex_.
+    void handOffParked();
+
+    // Block until a job is available for this core.
+    // Returns false once the simulation is over and nothing is left to run.
+    bool acquireGlobalJob(int core_id, Job& job);
+    bool acquireLocalJob(int core_id, Job& job);
+
+    // Pop from one core's run queue / from the busiest peer
+    bool popFrom(int core_id, RunQueue& run_queue, Job& job);
+    bool stealJob(int thief_core, Job& job);
+
+    // Snapshot every run queue's length into this core's scratch buffer
+    const std::vector<std::size_t>& queueLengths(int core_id);
+    void snapshotLengths(std::vector<std::size_t>& lengths) const;
+
+    // Report the end of a slice to the policy, then either record the job as
+    // completed, send it to I/O, or requeue it (globally, or on the run queue
+    // placement picks). Only a requeue takes a ready-queue lock.
+    void endSlice(int core_id, Job job, double finish_time);
+
+    // Merge the per-core completion buffers in finish-time order
+    void mergeCompleted();
+
+    // Execute a job on a CPU core (simulated by sleeping through the switch
+    // overhead, then the slice). run_start is when the slice itself begins.
+    // Returns the time actually run, shorter than time_slice if preempted.
+    float executeJob(Job& job, float time_slice, float overhead, double run_start, int core_id,
+                     std::uint64_t acquired_at);
+
+    // Real execution: run the core's kernel for time_slice x time_scale wall
+    // seconds of calibrated work and time it. The modelled switch overhead is
+    // not run; the host's real cost from acquired_at (when the job was popped)
+    // to the kernel starting is recorded instead.
+    float runKernel(const Job& job, float time_slice, double run_start, int core_id,
+                    std::uint64_t acquired_at);
+
+    // Publish what a preemptible core runs / retire it, returning the time
+    // actually run (shorter than slice if an arrival cut it)
+    void armSlot(int core_id, const Job& job, double run_start, float slice);
+    float disarmSlot(int core_id, double run_start, float slice);
+
+    // Core whose running job the policy most wants to displace for `arriving`
+    // (-1 if none), among all cores or only only_core if it is >= 0;
+    // victim_job_id is set to that core's running job
+    int choosePreemptionVictim(const Job& arriving, int only_core, int& victim_job_id);
+
+    // Cut the core's slice at cut_time if it is still running victim_job_id
+    void cutSlice(int core_id, int victim_job_id, double cut_time);
+
+    // Where core_id charges its lock holds (nullptr when not profiling)
+    LockStats* lockProfile(int core_id) {
+        return profile_locks_ ? &locals_[static_cast<std::size_t>(core_id)].locks : nullptr;
+    }
+
+    // Append one record to the trace, if any (serialised across workers)
+    void traceEvent(TraceEventType type, double time, const Job& job, int core_id,
+                    float value, std::int32_t aux = 0);
+
     int num_cores_;
     ISchedulingPolicy& policy_;
-    std::vector<Job>& ready_queue_;
+    ReadyQueue& ready_queue_;
     std::mutex& queue_mutex_;
     std::condition_variable& job_available_;
     std::atomic<bool>& simulation_running_;
-    std::vector<Job>& completed_jobs_;
-    std::mutex& completed_mutex_;
+    JobTable& completed_jobs_;      // Filled by stop(), in completion order
     std::atomic<size_t>& context_switches_;
-    
+
+    QueueMode queue_mode_;
+    std::unique_ptr<PlacementPolicy> placement_;
+    std::vector<std::unique_ptr<RunQueue>> run_queues_;
+    std::vector<std::size_t> load_snapshot_;   // Scratch buffer for placement decisions
+    std::vector<std::unique_ptr<Handoff>> handoffs_;   // GLOBAL mode, one per core
+    std::vector<int> parked_;                  // Cores waiting on their handoff (queue_mutex_)
+    std::vector<Job> batch_;                   // popBatch() scratch (queue_mutex_)
+
+    TraceWriter* trace_ = nullptr;
+    std::mutex trace_mutex_;
+    LiveMetrics* live_ = nullptr;
+    AdmissionController* admission_ = nullptr;
+    CostModel cost_;
+    Topology topology_;
+    bool profile_locks_ = false;
+    bool deterministic_ = false;
+    std::unique_ptr<TurnSequencer> turns_;    // Deterministic mode, created by start()
+    DispatchLog* dispatch_log_ = nullptr;
+    ExecutionConfig execution_;
+    double units_per_second_ = 0.0;           // Calibrated kernel rate
+
     std::vector<std::thread> workers_;
     std::atomic<int> active_workers_;
-    
+    std::atomic<std::size_t> queued_jobs_;
+    std::atomic<std::size_t> outstanding_jobs_;
+    std::atomic<std::size_t> stolen_jobs_;
+    std::atomic<std::size_t> preemptions_;
+    std::vector<std::unique_ptr<CoreSlot>> slots_;
+
+    // I/O: blocked jobs in a min-heap on their due time
+    bool io_enabled_ = false;
+    IoDevice device_;
+    std::vector<Blocked> blocked_;
+    BlockedLater blocked_order_;
+    std::mutex io_mutex_;
+    std::condition_variable io_wakeup_;
+    std::thread io_thread_;
+    std::vector<std::size_t> io_lengths_;     // I/O thread's placement scratch
+
+    std::vector<WorkerLocal> locals_;
+
     // Track which core is executing which job
     std::vector<std::atomic<Job*>> executing_jobs_;
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
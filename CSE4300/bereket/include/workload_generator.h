@@ -0,0 +1,175 @@
+#ifndef CHRONOS_WORKLOAD_GENERATOR_H
+#define CHRONOS_WORKLOAD_GENERATOR_H
+
+#include "job.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// Seedable xoshiro256** generator. The variates below are computed here rather
+// than with <random>'s distributions, whose output differs between standard
+// libraries, so a seed names the same workload on every platform.
+class Rng {
+public:
+    explicit Rng(std::uint64_t seed = 1) { reseed(seed); }
+
+    void reseed(std::uint64_t seed);
+
+    std::uint64_t next() {
+        const std::uint64_t result = rotl(state_[1] * 5, 7) * 9;
+        const std::uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    // Uniform in [0, 1), 53 random bits
+    double uniform() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+    double uniform(double lo, double hi) { return lo + (hi - lo) * uniform(); }
+
+    // Uniform in (0, 1], safe to take the log of
+    double uniformOpen() { return 1.0 - uniform(); }
+
+    // Integer in [lo, hi]
+    int between(int lo, int hi);
+
+    double exponential(double rate) { return -std::log(uniformOpen()) / rate; }
+    double normal();
+
+private:
+    static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    std::uint64_t state_[4];
+    std::optional<double> spare_normal_;
+};
+
+// Inter-arrival process
+enum class ArrivalModel {
+    POISSON,   // Exponential gaps at a constant rate
+    MMPP,      // Two-state Markov-modulated Poisson: quiet periods and bursts
+    DIURNAL    // Poisson whose rate follows a sine wave (day/night load)
+};
+
+// CPU demand of each job
+enum class ServiceModel {
+    UNIFORM,     // Uniform in [0.2, 1.8] x mean (the sample generator's 1-10 s at mean 5.5)
+    PARETO,      // Heavy tail: a few jobs carry most of the work
+    LOGNORMAL,   // Long right tail, no jobs near zero
+    BIMODAL      // Mostly short jobs plus a minority of long ones
+};
+
+// A tenant's share of the jobs and the priorities its jobs are drawn from.
+// Jobs carry the tenant's position in GeneratorConfig::tenants as their tenant id.
+struct TenantMix {
+    double weight = 1.0;
+    int min_priority = 1;
+    int max_priority = 5;
+};
+
+struct GeneratorConfig {
+    std::uint64_t seed = 1;
+    std::uint64_t num_jobs = 0;
+
+    ArrivalModel arrivals = ArrivalModel::POISSON;
+    double rate = 1.0;              // Mean arrivals per second (all models)
+
+    // MMPP: the burst state's rate is burst_ratio x the quiet state's, and the
+    // process spends burst_share of its time bursting, about burst_length
+    // arrivals per burst; rates are scaled so the long-run mean stays `rate`
+    double burst_ratio = 10.0;
+    double burst_share = 0.1;
+    double burst_length = 20.0;
+
+    // DIURNAL: rate x (1 + amplitude x sin(2 pi t / period))
+    double period = 600.0;
+    double amplitude = 0.8;
+
+    ServiceModel service = ServiceModel::UNIFORM;
+    double service_mean = 5.5;      // Seconds of CPU per job (all models)
+    double pareto_alpha = 1.5;      // Tail index (> 1, so the mean exists)
+    double lognormal_sigma = 1.0;   // Std. dev. of log(service)
+    double long_share = 0.1;        // BIMODAL: fraction of long jobs ...
+    double long_ratio = 20.0;       // ... and how much longer they are than short ones
+
+    // Empty: one tenant with priorities 1-5
+    std::vector<TenantMix> tenants;
+
+    // Shares of critical, standard and best-effort jobs (SloClass order);
+    // empty: every job is standard
+    std::vector<double> slo_mix;
+
+    // > 0: deadline = arrival + service x (1 + deadline_slack), half that
+    // slack for critical jobs; best-effort jobs never get one. 0: no deadlines
+    double deadline_slack = 0.0;
+};
+
+// Lazily generated job stream: jobs come out in arrival order, one at a time,
+// in constant memory, so a 100M-job workload never exists as a vector.
+// The same config (including seed) always yields the same jobs.
+class JobStream {
+public:
+    explicit JobStream(const GeneratorConfig& config);
+
+    // Next job (ids 1..num_jobs, tenant and SLO class from the mixes); false once num_jobs
+    // have been produced
+    bool next(Job& job);
+
+    std::uint64_t generated() const { return generated_; }
+    const GeneratorConfig& config() const { return config_; }
+
+    // Materialise the rest of the stream
+    std::vector<Job> collect();
+
+private:
+    double nextArrival();
+    double nextService();
+    std::size_t nextTenant();
+    int nextPriority(std::size_t tenant);
+    SloClass nextSloClass();
+
+    GeneratorConfig config_;
+    Rng rng_;
+    std::uint64_t generated_ = 0;
+    double now_ = 0.0;
+
+    // MMPP state
+    bool bursting_ = false;
+    double dwell_left_ = 0.0;
+    double quiet_rate_ = 0.0;
+    double burst_rate_ = 0.0;
+    double quiet_dwell_ = 0.0;
+    double burst_dwell_ = 0.0;
+
+    // Cumulative tenant weights, normalised to 1
+    std::vector<double> tenant_cdf_;
+
+    // Cumulative SLO class weights, normalised to 1 (empty: no draw)
+    std::vector<double> slo_cdf_;
+};
+
+class WorkloadGenerator {
+public:
+    static bool validate(const GeneratorConfig& config);
+
+    static std::string arrivalToString(ArrivalModel model);
+    static std::optional<ArrivalModel> stringToArrival(const std::string& str);
+    static std::string serviceToString(ServiceModel model);
+    static std::optional<ServiceModel> stringToService(const std::string& str);
+
+    // "70:4-5,30:1-3": weight:priority or weight:min-max per tenant
+    static bool parseTenants(const std::string& spec, std::vector<TenantMix>& tenants);
+};
+
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef CHRONOS_WORKLOAD_LOADER_H
+#define CHRONOS_WORKLOAD_LOADER_H
+
+#include "job.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace chronos {
+
+// Compact binary workload header (24 bytes), followed by job_count WorkloadRecords
+struct WorkloadHeader {
+    char magic[8];              // "CHRJOBS" + NUL
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t job_count;
+};
+static_assert(sizeof(WorkloadHeader) == 24, "WorkloadHeader must stay 24 bytes");
+
+// One job (32 bytes, host byte order)
+struct WorkloadRecord {
+    double arrival_time;
+    double deadline;            // Absolute; +infinity for none
+    std::int32_t job_id;
+    float burst_time;
+    std::int16_t priority;
+    std::uint16_t tenant;
+    std::uint8_t slo_class;     // SloClass
+    std::uint8_t reserved[3];
+};
+static_assert(sizeof(WorkloadRecord) == 32, "WorkloadRecord must stay 32 bytes");
+
+// Loads job traces for --workload and saves job sets in the binary format.
+//
+// CSV: one job per line. With a header row, columns are matched by name
+// (job_id/id, arrival_time/arrival, burst_time/burst, priority, tenant,
+// deadline, slo) and any other column is ignored, so an exported metrics.csv
+// can be replayed. Without a header the columns are arrival,burst[,priority]
+// and ids are assigned 1..N. Priorities must fit in 16 bits and tenants in
+// 0-65535. A deadline is absolute (an empty cell: none); slo is critical,
+// standard or best-effort (or 0-2).
+// An optional "bursts" column gives alternating CPU and I/O bursts
+// ("3;1.5;2" = 3 s CPU, 1.5 s I/O, 2 s CPU) in place of burst_time.
+//
+// The file is memory-mapped and parsed in place; the only allocations are the
+// job vector itself, reserved up front from a line count, and the burst lists
+// of jobs with I/O.
+class WorkloadLoader {
+public:
+    static constexpr std::uint32_t VERSION = 4;    // 3 stored float times
+
+    // Binary vs CSV is detected from the file's magic bytes; binary files must
+    // be this VERSION. max_jobs > 0 stops after that many jobs. Job ids must
+    // be non-negative and unique (they key the ready queues' job indexes).
+    // Returns false on error.
+    static bool load(const std::string& path, std::vector<Job>& jobs, std::size_t max_jobs = 0);
+
+    // Write jobs (id, arrival, burst, priority, tenant, deadline, SLO class) in the binary format; I/O
+    // bursts are not stored (burst is the job's total CPU time)
+    static bool saveBinary(const std::string& path, const std::vector<Job>& jobs);
+
+    // Same, pulling jobs from next() until it returns false (e.g. a JobStream),
+    // so a workload can be written without ever holding it in memory
+    static bool saveBinary(const std::string& path, const std::function<bool(Job&)>& next);
+
+private:
+    static bool parseBinary(const char* data, std::size_t size, const std::string& path,
+                            std::vector<Job>& jobs, std::size_t max_jobs);
+    static bool parseCSV(const char* data, std::size_t size, const std::string& path,
+                         std::vector<Job>& jobs, std::size_t max_jobs);
+};
+
+}
+
+#endif
@@ -1,5 +1,7 @@
 #include "cli_parser.h"
+#include "dispatch_log.h"
 #include "job.h"
+#include "live_metrics.h"
 #include "scheduler_engine.h"
 #include "algorithm_comparator.h"
 #include "file_writer.h"
@@ -8,8 +10,19 @@
 #include "sjf_policy.h"
 #include "priority_policy.h"
 #include "rr_policy.h"
+#include "mlfq_policy.h"
+#include "cfs_policy.h"
+#include "srtf_policy.h"
+#include "edf_policy.h"
+#include "fair_share_policy.h"
 #include "scheduling_policy.h"
+#include "trace_writer.h"
+#include "workload_generator.h"
+#include "workload_loader.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <random>
@@ -17,13 +30,41 @@
 
 namespace chronos {
 
-// Generate sample jobs for testing
-std::vector<Job> generateSampleJobs(int num_jobs) {
+// Turn a share (io_mix) of the jobs into I/O-bound ones: each one's CPU time
+// is split into 2-4 equal bursts with 0.5-3 s of I/O between them. Uses its own
+// generator so the base job set for a seed is the same with or without I/O.
+void addIoBursts(std::vector<Job>& jobs, unsigned int seed, float io_mix) {
+    if (io_mix <= 0.0f) {
+        return;
+    }
+
+    std::mt19937 gen(seed ^ 0x9e3779b9u);
+    std::bernoulli_distribution io_bound(io_mix);
+    std::uniform_int_distribution<int> cpu_bursts_dist(2, 4);
+    std::uniform_real_distribution<float> io_dist(0.5f, 3.0f);
+
+    std::vector<float> bursts;
+    for (Job& job : jobs) {
+        if (!io_bound(gen)) {
+            continue;
+        }
+        const int cpu_bursts = cpu_bursts_dist(gen);
+        const float cpu = job.getBurstTime() / static_cast<float>(cpu_bursts);
+        bursts.assign(1, cpu);
+        for (int i = 1; i < cpu_bursts; ++i) {
+            bursts.push_back(io_dist(gen));
+            bursts.push_back(cpu);
+        }
+        job.setBursts(bursts);
+    }
+}
+
+// Generate sample jobs for testing (same seed => same job set)
+std::vector<Job> generateSampleJobs(int num_jobs, unsigned int seed, float io_mix = 0.0f) {
     std::vector<Job> jobs;
     jobs.reserve(num_jobs);
     
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    std::mt19937 gen(seed);
     std::uniform_real_distribution<float> arrival_dist(0.0f, 10.0f);
     std::uniform_real_distribution<float> burst_dist(1.0f, 10.0f);
     std::uniform_int_distribution<int> priority_dist(1, 5);
@@ -34,12 +75,32 @@ std::vector<Job> generateSampleJobs(int num_jobs) {
         int priority = priority_dist(gen);
         jobs.emplace_back(i, arrival, burst, priority);
     }
-    
+
+    addIoBursts(jobs, seed, io_mix);
+    return jobs;
+}
+
+// Workload model settings for one seed; an unset rate keeps the cores ~80% busy
+GeneratorConfig generatorConfig(const CLIOptions& options, unsigned int seed) {
+    GeneratorConfig config = options.generator;
+    config.seed = seed;
+    config.num_jobs = static_cast<std::uint64_t>(std::max(0, options.num_jobs));
+    config.rate = options.arrival_rate.value_or(0.8 * options.num_cores / config.service_mean);
+    return config;
+}
+
+// Jobs for one seed: the configured workload model, or the uniform sample set
+std::vector<Job> generateJobs(const CLIOptions& options, unsigned int seed) {
+    if (!options.use_generator) {
+        return generateSampleJobs(options.num_jobs, seed, options.io_mix);
+    }
+    std::vector<Job> jobs = JobStream(generatorConfig(options, seed)).collect();
+    addIoBursts(jobs, seed, options.io_mix);
     return jobs;
 }
 
-// Create policy from CLI options
-std::unique_ptr<ISchedulingPolicy> createPolicy(const CLIOptions& options) {
+// Create the --algo policy from CLI options
+std::unique_ptr<ISchedulingPolicy> createBasePolicy(const CLIOptions& options) {
     switch (options.algorithm) {
         case SchedulingAlgorithm::FCFS:
             return std::make_unique<FCFSPolicy>();
@@ -54,11 +115,38 @@ std::unique_ptr<ISchedulingPolicy> createPolicy(const CLIOptions& options) {
                 std::cerr << "Error: Quantum required for Round Robin algorithm\n";
                 return nullptr;
             }
+        case SchedulingAlgorithm::MLFQ:
+            return std::make_unique<MLFQPolicy>(options.quantum.value_or(2));
+        case SchedulingAlgorithm::CFS:
+            return std::make_unique<CFSPolicy>(static_cast<float>(options.quantum.value_or(2)));
+        case SchedulingAlgorithm::SRTF:
+            return std::make_unique<SRTFPolicy>();
+        case SchedulingAlgorithm::PRIORITY_PREEMPTIVE:
+            return std::make_unique<PreemptivePriorityPolicy>();
+        case SchedulingAlgorithm::EDF:
+            return std::make_unique<EDFPolicy>();
         default:
             return nullptr;
     }
 }
 
+// Create policy from CLI options: with --fair-share, one --algo policy per
+// tenant of the job set, under weighted fair queueing across tenants
+std::unique_ptr<ISchedulingPolicy> createPolicy(const CLIOptions& options,
+                                                const std::vector<Job>& jobs) {
+    auto base = createBasePolicy(options);
+    if (!base || !options.fair_share) {
+        return base;
+    }
+
+    int tenants = 1;
+    for (const Job& job : jobs) {
+        tenants = std::max(tenants, job.getTenant() + 1);
+    }
+    return std::make_unique<FairSharePolicy>([&options] { return createBasePolicy(options); },
+                                             tenants, options.tenant_weights);
+}
+
 } // namespace chronos
 
 int main(int argc, char* argv[]) {
@@ -70,41 +158,173 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     
-    // Generate jobs
-    if (options.num_jobs <= 0) {
+    // Replay a workload file, or generate jobs
+    std::vector<Job> workload;
+    if (!options.workload_file.empty()) {
+        const std::size_t max_jobs = options.num_jobs > 0 ? static_cast<std::size_t>(options.num_jobs) : 0;
+        if (!WorkloadLoader::load(options.workload_file, workload, max_jobs)) {
+            return 1;
+        }
+        std::cout << "Loaded " << workload.size() << " jobs from " << options.workload_file << "\n";
+    } else if (options.num_jobs <= 0) {
         std::cerr << "Error: Number of jobs must be positive\n";
         return 1;
+    } else if (options.use_generator && !WorkloadGenerator::validate(generatorConfig(options, 0))) {
+        return 1;
+    }
+
+    // Deterministic runs default to a fixed seed rather than a random one
+    unsigned int seed = options.seed.value_or(1);
+    if (!options.seed.has_value() && !options.sweep && !options.engine.deterministic) {
+        seed = std::random_device()();
+        if (options.use_generator) {
+            std::cout << "Seed: " << seed << " (pass --seed to reproduce)\n";
+        }
+    }
+
+    // Generated models are streamed to the file, never held in memory
+    if (options.generate_only && workload.empty() && options.use_generator) {
+        JobStream stream(generatorConfig(options, seed));
+        if (!WorkloadLoader::saveBinary(options.save_workload,
+                                        [&stream](Job& job) { return stream.next(job); })) {
+            return 1;
+        }
+        std::cout << "Saved " << stream.generated() << " jobs to " << options.save_workload << "\n";
+        return 0;
+    }
+
+    if (options.sweep) {
+        SweepGrid grid;
+        grid.algorithms = options.sweep_algorithms;
+        if (grid.algorithms.empty()) {
+            grid.algorithms = {SchedulingAlgorithm::FCFS, SchedulingAlgorithm::SJF,
+                               SchedulingAlgorithm::PRIORITY, SchedulingAlgorithm::RR,
+                               SchedulingAlgorithm::MLFQ, SchedulingAlgorithm::CFS,
+                               SchedulingAlgorithm::SRTF, SchedulingAlgorithm::PRIORITY_PREEMPTIVE,
+                               SchedulingAlgorithm::EDF};
+        }
+        grid.core_counts = options.sweep_cores.empty()
+                               ? std::vector<int>{options.num_cores} : options.sweep_cores;
+        grid.quanta = options.sweep_quanta.empty()
+                          ? std::vector<int>{options.quantum.value_or(2)} : options.sweep_quanta;
+        grid.seeds = options.sweep_seeds.empty()
+                         ? std::vector<unsigned int>{options.seed.value_or(1)} : options.sweep_seeds;
+        grid.threads = options.threads;
+
+        // A workload file is the same for every seed
+        bool success = AlgorithmComparator::sweep(
+            grid,
+            [&options, &workload](unsigned int sweep_seed) {
+                return workload.empty() ? generateJobs(options, sweep_seed) : workload;
+            },
+            options.engine);
+        return success ? 0 : 1;
+    }
+
+    std::vector<Job> jobs;
+    if (!workload.empty()) {
+        jobs = std::move(workload);
+    } else {
+        jobs = generateJobs(options, seed);
+    }
+
+    if (!options.save_workload.empty()) {
+        if (!WorkloadLoader::saveBinary(options.save_workload, jobs)) {
+            return 1;
+        }
+        std::cout << "Saved " << jobs.size() << " jobs to " << options.save_workload << "\n";
+    }
+    if (options.generate_only) {
+        return 0;
+    }
+
+    // Live stats during the run(s); the publisher sends a final record and
+    // stops when it goes out of scope
+    LiveMetrics live;
+    StatsPublisher publisher(live, std::chrono::milliseconds(options.live_interval_ms));
+    if (!options.live_target.empty()) {
+        if (!publisher.start(options.live_target)) {
+            return 1;
+        }
+        options.engine.live = &live;
     }
     
-    std::vector<Job> jobs = generateSampleJobs(options.num_jobs);
-    
+    // Deterministic threaded runs share one ready queue, and a single run can
+    // record its dispatch log or check itself against one
+    const bool threaded_deterministic =
+        options.engine.deterministic && options.engine.mode == EngineMode::THREADED;
+    if (threaded_deterministic) {
+        options.engine.queue_mode = QueueMode::GLOBAL;
+    }
+    DispatchLog dispatch_log;
+    if (threaded_deterministic && !options.compare_all &&
+        (!options.record_file.empty() || !options.replay_file.empty())) {
+        if (!options.replay_file.empty() && !dispatch_log.load(options.replay_file)) {
+            return 1;
+        }
+        options.engine.dispatch_log = &dispatch_log;
+    }
+
     if (options.compare_all) {
         int quantum = options.quantum.value_or(2);
         bool success = AlgorithmComparator::compareAll(
-            jobs, options.num_cores, quantum);
+            jobs, options.num_cores, quantum, options.engine);
         return success ? 0 : 1;
     }
     
-    auto policy = createPolicy(options);
+    auto policy = createPolicy(options, jobs);
     if (!policy) {
         std::cerr << "Error: Failed to create scheduling policy\n";
         return 1;
     }
     
     // Run scheduler
-    SchedulerEngine engine;
+    SchedulerEngine engine(options.engine);
+
+    TraceWriter trace;
+    if (!options.trace_file.empty()) {
+        if (!trace.open(options.trace_file, policy->getName(), options.trace_mmap)) {
+            return 1;
+        }
+        engine.setTraceWriter(&trace);
+    }
+
     auto result = engine.run(std::move(jobs), *policy, options.num_cores);
+
+    if (trace.isOpen()) {
+        const std::uint64_t records = trace.getRecordCount();
+        if (!trace.close()) {
+            std::cerr << "Error: Failed to write trace: " << options.trace_file << "\n";
+            return 1;
+        }
+        std::cout << "Trace written to " << options.trace_file
+                  << " (" << records << " events)\n";
+    }
+
+    if (options.engine.dispatch_log) {
+        if (!options.record_file.empty()) {
+            if (!dispatch_log.save(options.record_file, policy->getName(), options.num_cores, seed)) {
+                return 1;
+            }
+            std::cout << "Dispatch log written to " << options.record_file << " ("
+                      << dispatch_log.records().size() << " dispatches)\n";
+        }
+        dispatch_log.printReplay(std::cout, policy->getName(), options.num_cores);
+    }
     
     MetricsCollector collector;
     collector.setMakespan(result.makespan);
     collector.setCpuActiveTime(result.cpu_active_time);
     collector.setContextSwitches(result.context_switches);
     collector.setNumCores(options.num_cores);
-    for (const auto& job : result.completed_jobs) {
-        collector.recordJobCompletion(job);
-    }
+    collector.setEnergy(result.energy);
+    collector.setCompletedJobs(std::move(result.completed_jobs));
     
     FileWriter::writeAll(collector, *policy, "output");
-    
+
+    // A replay that diverged fails, so scripts can bisect on it
+    if (dispatch_log.replaying() && !dispatch_log.matches()) {
+        return 1;
+    }
     return 0;
 }
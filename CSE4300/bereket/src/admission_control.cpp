@@ -0,0 +1,119 @@
+#include "admission_control.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace chronos {
+
+bool AdmissionController::admit(Job& job, const AdmissionView& view) {
+    ++stats_.arrivals;
+    if (hasRoom(job, view)) {
+        return true;
+    }
+    if (action_ == AdmissionAction::DOWNGRADE && job.getSloClass() != SloClass::BEST_EFFORT) {
+        job.downgrade();
+        ++stats_.downgraded;
+        return true;
+    }
+    ++stats_.rejected;
+    stats_.rejected_deadlines += job.hasDeadline() ? 1 : 0;
+    return false;
+}
+
+QueueLengthAdmission::QueueLengthAdmission(std::size_t max_queued, AdmissionAction action)
+    : AdmissionController(action)
+    , max_queued_(max_queued)
+{
+}
+
+std::string QueueLengthAdmission::getName() const {
+    return "Queue Length " + std::to_string(max_queued_);
+}
+
+bool QueueLengthAdmission::hasRoom(const Job& /*job*/, const AdmissionView& view) {
+    return view.queued < max_queued_;
+}
+
+TokenBucketAdmission::TokenBucketAdmission(double rate, double burst, AdmissionAction action)
+    : AdmissionController(action)
+    , rate_(rate)
+    , burst_(std::max(1.0, burst))
+    , tokens_(burst_)
+{
+}
+
+std::string TokenBucketAdmission::getName() const {
+    std::ostringstream name;
+    name << "Token Bucket " << rate_ << "/s, burst " << burst_;
+    return name.str();
+}
+
+bool TokenBucketAdmission::hasRoom(const Job& job, const AdmissionView& /*view*/) {
+    // The bucket starts full at the first arrival
+    const double now = job.getArrivalTime();
+    if (started_) {
+        tokens_ = std::min(burst_, tokens_ + std::max(0.0, now - last_refill_) * rate_);
+    }
+    started_ = true;
+    last_refill_ = now;
+
+    if (tokens_ < 1.0) {
+        return false;
+    }
+    tokens_ -= 1.0;
+    return true;
+}
+
+PredictedWaitAdmission::PredictedWaitAdmission(double max_wait, AdmissionAction action)
+    : AdmissionController(action)
+    , max_wait_(max_wait)
+{
+}
+
+std::string PredictedWaitAdmission::getName() const {
+    std::ostringstream name;
+    name << "Predicted Wait";
+    if (max_wait_ > 0.0) {
+        name << " " << max_wait_ << "s";
+    }
+    return name.str();
+}
+
+bool PredictedWaitAdmission::hasRoom(const Job& job, const AdmissionView& view) {
+    burst_sum_ += job.getBurstTime();
+    ++burst_count_;
+    const double mean_burst = burst_sum_ / static_cast<double>(burst_count_);
+    const double wait = static_cast<double>(view.queued) * mean_burst /
+                        static_cast<double>(std::max(1, view.num_cores));
+
+    if (job.hasDeadline()) {
+        return job.getArrivalTime() + wait + job.getBurstTime() <= job.getDeadline();
+    }
+    return max_wait_ <= 0.0 || wait <= max_wait_;
+}
+
+std::unique_ptr<AdmissionController> createAdmissionController(const AdmissionConfig& config) {
+    switch (config.kind) {
+        case AdmissionKind::QUEUE_LENGTH:
+            return std::make_unique<QueueLengthAdmission>(config.max_queued, config.action);
+        case AdmissionKind::TOKEN_BUCKET:
+            return std::make_unique<TokenBucketAdmission>(config.rate, config.burst, config.action);
+        case AdmissionKind::PREDICTED_WAIT:
+            return std::make_unique<PredictedWaitAdmission>(config.max_wait, config.action);
+        case AdmissionKind::NONE:
+        default:
+            return nullptr;
+    }
+}
+
+std::string admissionToString(const AdmissionConfig& config) {
+    const std::unique_ptr<AdmissionController> controller = createAdmissionController(config);
+    return controller ? controller->getName() + ", " + admissionActionToString(config.action)
+                      : "None";
+}
+
+std::string admissionActionToString(AdmissionAction action) {
+    return action == AdmissionAction::DOWNGRADE ? "downgrade" : "reject";
+}
+
+}
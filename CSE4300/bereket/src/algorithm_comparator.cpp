@@ -4,16 +4,50 @@
 #include "sjf_policy.h"
 #include "priority_policy.h"
 #include "rr_policy.h"
+#include "mlfq_policy.h"
+#include "cfs_policy.h"
+#include "srtf_policy.h"
+#include "edf_policy.h"
 #include "scheduler_engine.h"
 #include "file_writer.h"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <thread>
 
 namespace chronos {
+namespace {
+
+// One point of the sweep grid plus the CSV row it produced
+struct SweepCell {
+    SchedulingAlgorithm algorithm;
+    int num_cores;
+    int quantum;            // 0 when the algorithm is not time-sliced
+    std::size_t workload;   // Index into the per-seed workloads
+    unsigned int seed;
+    std::string row;
+    bool ok = false;
+
+    // Kept for the merged per-configuration rows
+    LatencyStats latency;
+    float avg_waiting = 0.0f;
+    float cpu_utilization = 0.0f;
+    std::size_t context_switches = 0;
+    std::size_t num_jobs = 0;
+    float makespan = 0.0f;
+};
+
+bool usesQuantum(SchedulingAlgorithm algo) {
+    return algo == SchedulingAlgorithm::RR || algo == SchedulingAlgorithm::MLFQ ||
+           algo == SchedulingAlgorithm::CFS;
+}
+
+} // namespace
 
 std::unique_ptr<ISchedulingPolicy> AlgorithmComparator::createPolicy(
     SchedulingAlgorithm algo, int quantum) {
@@ -26,6 +60,16 @@ std::unique_ptr<ISchedulingPolicy> AlgorithmComparator::createPolicy(
             return std::make_unique<PriorityPolicy>();
         case SchedulingAlgorithm::RR:
             return std::make_unique<RoundRobinPolicy>(quantum);
+        case SchedulingAlgorithm::MLFQ:
+            return std::make_unique<MLFQPolicy>(quantum);
+        case SchedulingAlgorithm::CFS:
+            return std::make_unique<CFSPolicy>(static_cast<float>(quantum));
+        case SchedulingAlgorithm::SRTF:
+            return std::make_unique<SRTFPolicy>();
+        case SchedulingAlgorithm::PRIORITY_PREEMPTIVE:
+            return std::make_unique<PreemptivePriorityPolicy>();
+        case SchedulingAlgorithm::EDF:
+            return std::make_unique<EDFPolicy>();
         default:
             return nullptr;
     }
@@ -35,25 +79,25 @@ bool AlgorithmComparator::runAndWriteAlgorithm(
     std::vector<Job> jobs,
     std::unique_ptr<ISchedulingPolicy> policy,
     int num_cores,
+    const EngineConfig& engine_config,
     const std::string& output_dir) {
     
     if (!policy) {
         return false;
     }
     
-    // Create a fresh copy of jobs for this algorithm run
-    std::vector<Job> jobs_copy;
-    jobs_copy.reserve(jobs.size());
-    for (const auto& job : jobs) {
-        // Reset job state for new run - create fresh job with same parameters
-        Job new_job(job.getId(), job.getArrivalTime(), 
-                   job.getBurstTime(), job.getPriority());
-        jobs_copy.push_back(new_job);
+    // jobs is already this run's own copy: reset each job's state in place
+    for (auto& job : jobs) {
+        Job fresh(job.getId(), job.getArrivalTime(), job.getBurstTime(), job.getPriority(),
+                  job.getTenant());
+        fresh.setDeadline(job.getDeadline());
+        fresh.setSloClass(job.getSloClass());
+        job = std::move(fresh);
     }
     
     // Run scheduler
-    SchedulerEngine engine;
-    auto schedule_result = engine.run(std::move(jobs_copy), *policy, num_cores);
+    SchedulerEngine engine(engine_config);
+    auto schedule_result = engine.run(std::move(jobs), *policy, num_cores);
     
     // Create metrics collector from schedule result
     MetricsCollector collector;
@@ -61,16 +105,20 @@ bool AlgorithmComparator::runAndWriteAlgorithm(
     collector.setCpuActiveTime(schedule_result.cpu_active_time);
     collector.setContextSwitches(schedule_result.context_switches);
     collector.setNumCores(num_cores);
-    for (const auto& job : schedule_result.completed_jobs) {
-        collector.recordJobCompletion(job);
-    }
+    collector.setEnergy(schedule_result.energy);
+    collector.setCompletedJobs(std::move(schedule_result.completed_jobs));
     
     // Write to CSV (summary.csv will append, metrics.csv will overwrite)
     // For compare-all, we want to append metrics too, so we'll use a different approach
+    if (collector.getEnergy().enabled &&
+        !FileWriter::writeEnergyCSV(collector, *policy, output_dir + "/energy.csv")) {
+        return false;
+    }
     return FileWriter::writeSummaryCSV(collector, *policy, output_dir + "/summary.csv");
 }
 
-bool AlgorithmComparator::compareAll(std::vector<Job> jobs, int num_cores, int quantum) {
+bool AlgorithmComparator::compareAll(std::vector<Job> jobs, int num_cores, int quantum,
+                                     const EngineConfig& engine) {
     if (jobs.empty()) {
         std::cerr << "Error: No jobs provided for comparison\n";
         return false;
@@ -85,12 +133,20 @@ bool AlgorithmComparator::compareAll(std::vector<Job> jobs, int num_cores, int q
         SchedulingAlgorithm::FCFS,
         SchedulingAlgorithm::SJF,
         SchedulingAlgorithm::PRIORITY,
-        SchedulingAlgorithm::RR
+        SchedulingAlgorithm::RR,
+        SchedulingAlgorithm::MLFQ,
+        SchedulingAlgorithm::CFS,
+        SchedulingAlgorithm::SRTF,
+        SchedulingAlgorithm::PRIORITY_PREEMPTIVE,
+        SchedulingAlgorithm::EDF
     };
     
     // Clear summary.csv for fresh comparison
     std::ofstream clear_file("output/summary.csv", std::ios::trunc);
     clear_file.close();
+    if (engine.power.enabled() && engine.mode == EngineMode::DISCRETE_EVENT) {
+        std::ofstream clear_energy("output/energy.csv", std::ios::trunc);
+    }
     
     bool all_success = true;
     
@@ -104,10 +160,11 @@ bool AlgorithmComparator::compareAll(std::vector<Job> jobs, int num_cores, int q
             continue;
         }
         
-        std::cout << "Running " << policy->getName() << "...\n";
-        bool success = runAndWriteAlgorithm(jobs, std::move(policy), num_cores);
+        const std::string name = policy->getName();
+        std::cout << "Running " << name << "...\n";
+        bool success = runAndWriteAlgorithm(jobs, std::move(policy), num_cores, engine);
         if (!success) {
-            std::cerr << "Warning: Failed to run " << policy->getName() << "\n";
+            std::cerr << "Warning: Failed to run " << name << "\n";
             all_success = false;
         }
     }
@@ -120,4 +177,192 @@ bool AlgorithmComparator::compareAll(std::vector<Job> jobs, int num_cores, int q
     return all_success;
 }
 
+bool AlgorithmComparator::sweep(const SweepGrid& grid,
+                                const WorkloadFactory& make_workload,
+                                const EngineConfig& engine,
+                                const std::string& filename) {
+    if (grid.algorithms.empty() || grid.core_counts.empty() || grid.seeds.empty()) {
+        std::cerr << "Error: Sweep grid needs at least one algorithm, core count and seed\n";
+        return false;
+    }
+
+    // One immutable workload per seed, shared by every cell that uses it
+    std::vector<std::vector<Job>> workloads;
+    workloads.reserve(grid.seeds.size());
+    for (unsigned int seed : grid.seeds) {
+        workloads.push_back(make_workload(seed));
+        SchedulerEngine::sortByArrival(workloads.back());
+    }
+
+    const std::vector<int> no_quantum = {0};
+    const std::vector<int>& quanta = grid.quanta.empty() ? no_quantum : grid.quanta;
+
+    std::vector<SweepCell> cells;
+    for (auto algo : grid.algorithms) {
+        for (int cores : grid.core_counts) {
+            const std::vector<int>& cell_quanta = usesQuantum(algo) ? quanta : no_quantum;
+            for (int quantum : cell_quanta) {
+                for (std::size_t w = 0; w < grid.seeds.size(); ++w) {
+                    SweepCell cell;
+                    cell.algorithm = algo;
+                    cell.num_cores = cores;
+                    cell.quantum = quantum;
+                    cell.workload = w;
+                    cell.seed = grid.seeds[w];
+                    cells.push_back(std::move(cell));
+                }
+            }
+        }
+    }
+
+    int num_threads = grid.threads > 0
+                          ? grid.threads
+                          : static_cast<int>(std::thread::hardware_concurrency());
+    num_threads = std::max(1, std::min(num_threads, static_cast<int>(cells.size())));
+
+    std::cout << "\n========================================\n";
+    std::cout << "Sweeping " << cells.size() << " cells on " << num_threads << " threads\n";
+    std::cout << "========================================\n\n";
+
+    EngineConfig cell_engine = engine;
+    cell_engine.print_summary = false;
+
+    // Cells are independent: each thread pulls the next index and writes only to its own cell
+    std::atomic<std::size_t> next_cell(0);
+    auto run_cells = [&]() {
+        while (true) {
+            const std::size_t index = next_cell.fetch_add(1);
+            if (index >= cells.size()) {
+                return;
+            }
+            SweepCell& cell = cells[index];
+
+            auto policy = createPolicy(cell.algorithm, cell.quantum > 0 ? cell.quantum : 2);
+            if (!policy) {
+                continue;
+            }
+
+            SchedulerEngine scheduler(cell_engine);
+            auto result = scheduler.run(workloads[cell.workload], *policy, cell.num_cores);
+
+            MetricsCollector collector;
+            collector.setMakespan(result.makespan);
+            collector.setCpuActiveTime(result.cpu_active_time);
+            collector.setContextSwitches(result.context_switches);
+            collector.setNumCores(cell.num_cores);
+            collector.setCompletedJobs(std::move(result.completed_jobs));
+
+            std::ostringstream row;
+            row << policy->getName() << ","
+                << cell.num_cores << ","
+                << cell.quantum << ","
+                << cell.seed << ","
+                << std::fixed << std::setprecision(2)
+                << collector.getAverageWaitingTime() << ","
+                << collector.getAverageTurnaroundTime() << ","
+                << collector.getCpuUtilizationPercent() << ","
+                << collector.getContextSwitches() << ","
+                << collector.getJobCount() << ","
+                << collector.getMakespan();
+            FileWriter::writeLatencyColumns(row, collector.getLatencyStats());
+            row << "\n";
+            cell.row = row.str();
+            cell.latency = collector.getLatencyStats();
+            cell.avg_waiting = collector.getAverageWaitingTime();
+            cell.cpu_utilization = collector.getCpuUtilizationPercent();
+            cell.context_switches = collector.getContextSwitches();
+            cell.num_jobs = collector.getJobCount();
+            cell.makespan = collector.getMakespan();
+            cell.ok = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back(run_cells);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Merge the per-cell buffers in grid order
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open file for writing: " << filename << "\n";
+        return false;
+    }
+    file << "algorithm,cores,quantum,seed,avg_waiting_time,avg_turnaround_time,"
+         << "cpu_utilization,context_switches,num_jobs,makespan"
+         << FileWriter::latencyColumnsHeader() << "\n";
+
+    bool all_success = true;
+    for (const auto& cell : cells) {
+        if (!cell.ok) {
+            std::cerr << "Warning: Failed to run " << CLIParser::algorithmToString(cell.algorithm)
+                      << " (cores=" << cell.num_cores << ", seed=" << cell.seed << ")\n";
+            all_success = false;
+            continue;
+        }
+        file << cell.row;
+    }
+
+    // With several seeds, add one row per configuration (seed "all") whose
+    // percentiles come from the merged histograms of its seeds; the other
+    // columns are means over the seeds (num_jobs is the total)
+    const std::size_t num_seeds = grid.seeds.size();
+    if (num_seeds > 1) {
+        file << std::fixed << std::setprecision(2);
+        for (std::size_t first = 0; first + num_seeds <= cells.size(); first += num_seeds) {
+            LatencyStats merged;
+            double avg_waiting = 0.0;
+            double cpu_utilization = 0.0;
+            double context_switches = 0.0;
+            double makespan = 0.0;
+            std::size_t num_jobs = 0;
+            std::size_t runs = 0;
+            for (std::size_t i = first; i < first + num_seeds; ++i) {
+                const SweepCell& cell = cells[i];
+                if (!cell.ok) {
+                    continue;
+                }
+                merged.merge(cell.latency);
+                avg_waiting += cell.avg_waiting * cell.num_jobs;
+                cpu_utilization += cell.cpu_utilization;
+                context_switches += static_cast<double>(cell.context_switches);
+                makespan += cell.makespan;
+                num_jobs += cell.num_jobs;
+                ++runs;
+            }
+            if (runs == 0) {
+                continue;
+            }
+
+            const SweepCell& cell = cells[first];
+            file << createPolicy(cell.algorithm, cell.quantum > 0 ? cell.quantum : 2)->getName() << ","
+                 << cell.num_cores << ","
+                 << cell.quantum << ",all,"
+                 << (num_jobs ? avg_waiting / num_jobs : 0.0) << ","
+                 << merged.turnaround.mean() << ","
+                 << cpu_utilization / runs << ","
+                 << context_switches / runs << ","
+                 << num_jobs << ","
+                 << makespan / runs;
+            FileWriter::writeLatencyColumns(file, merged);
+            file << "\n";
+        }
+    }
+
+    file.close();
+    if (file.fail()) {
+        std::cerr << "Error: Failed to write to file: " << filename << "\n";
+        return false;
+    }
+
+    std::cout << "Sweep complete!\n";
+    std::cout << "Results written to " << filename << "\n";
+
+    return all_success;
+}
+
 } // namespace chronos
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "cfs_policy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace chronos {
+namespace {
+// Linux sched_prio_to_weight, nice -20 .. 19
+constexpr int PRIO_TO_WEIGHT[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,
+     3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,
+      335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,
+       36,    29,    23,    18,    15,
+};
+
+// Priority 3 is nice 0; a larger priority number means more important
+constexpr int NICE_0_PRIORITY = 3;
+} // namespace
+
+CFSPolicy::CFSPolicy(float target_latency, float min_granularity)
+    : target_latency_(target_latency)
+    , min_granularity_(min_granularity > 0.0f ? min_granularity : target_latency / 8.0f)
+{
+    if (!(target_latency_ > 0.0f)) {
+        throw std::invalid_argument("CFSPolicy requires a positive target latency.");
+    }
+    min_granularity_ = std::min(min_granularity_, target_latency_);
+}
+
+float CFSPolicy::weightOf(const Job& job) {
+    const int nice = std::max(-20, std::min(19, NICE_0_PRIORITY - job.getPriority()));
+    return static_cast<float>(PRIO_TO_WEIGHT[nice + 20]);
+}
+
+Job* CFSPolicy::getNextJob(std::vector<Job>& ready_queue) {
+    auto it = std::min_element(ready_queue.begin(), ready_queue.end(),
+                               [](const Job& a, const Job& b) {
+                                   if (a.getVirtualRuntime() != b.getVirtualRuntime()) {
+                                       return a.getVirtualRuntime() < b.getVirtualRuntime();
+                                   }
+                                   return a.getId() < b.getId();
+                               });
+    return it != ready_queue.end() ? &(*it) : nullptr;
+}
+
+float CFSPolicy::getTimeSlice(const Job& job) const {
+    // The dispatched job has already left the queue, so add it back
+    const float weight = weightOf(job);
+    const float queued = static_cast<float>(queued_weight_.load(std::memory_order_relaxed));
+    const float share = target_latency_ * weight / (queued + weight);
+    return std::max(min_granularity_, share);
+}
+
+void CFSPolicy::onJobCompletion(Job* completed_job, double /*current_time*/) {
+    if (completed_job && !completed_job->isFinished()) {
+        const float charged = completed_job->getLastSlice() * NICE_0_WEIGHT / weightOf(*completed_job);
+        completed_job->setVirtualRuntime(completed_job->getVirtualRuntime() + charged);
+    }
+}
+
+void CFSPolicy::addQueuedWeight(float weight) {
+    queued_weight_.fetch_add(static_cast<std::int64_t>(std::lround(weight)), std::memory_order_relaxed);
+}
+
+std::unique_ptr<ReadyQueue> CFSPolicy::createReadyQueue() {
+    return std::make_unique<CFSReadyQueue>(*this);
+}
+
+CFSReadyQueue::CFSReadyQueue(CFSPolicy& policy)
+    : policy_(policy)
+    , tree_(std::less<Key>(), Tree::allocator_type(node_pool_))
+{
+}
+
+void CFSReadyQueue::insert(Job job) {
+    const Key key{job.getVirtualRuntime(), next_seq_++};
+    const int job_id = job.getId();
+    policy_.addQueuedWeight(CFSPolicy::weightOf(job));
+    index_.set(job_id, key);
+    tree_.emplace(key, std::move(job));
+}
+
+void CFSReadyQueue::push(Job job) {
+    // New or migrated work starts level with the queue
+    job.setVirtualRuntime(std::max(job.getVirtualRuntime(), min_vruntime_));
+    insert(std::move(job));
+}
+
+void CFSReadyQueue::requeue(Job job) {
+    // Keep earned credit, but never more than one period's worth
+    const float floor = min_vruntime_ - policy_.getTimeSlice();
+    job.setVirtualRuntime(std::max(job.getVirtualRuntime(), floor));
+    insert(std::move(job));
+}
+
+bool CFSReadyQueue::pop(Job& out) {
+    if (tree_.empty()) {
+        return false;
+    }
+    auto it = tree_.begin();
+    min_vruntime_ = std::max(min_vruntime_, it->first.vruntime);
+    out = std::move(it->second);
+    index_.erase(out.getId());
+    tree_.erase(it);
+    policy_.addQueuedWeight(-CFSPolicy::weightOf(out));
+    return true;
+}
+
+bool CFSReadyQueue::remove(int job_id, Job& out) {
+    const Key* found = index_.find(job_id);
+    if (!found) {
+        return false;
+    }
+    auto it = tree_.find(*found);
+    out = std::move(it->second);
+    tree_.erase(it);
+    index_.erase(job_id);
+    policy_.addQueuedWeight(-CFSPolicy::weightOf(out));
+    return true;
+}
+
+bool CFSReadyQueue::contains(int job_id) const {
+    return index_.contains(job_id);
+}
+
+}
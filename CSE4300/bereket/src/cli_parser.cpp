@@ -1,8 +1,10 @@
 #include "cli_parser.h"
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 #include <algorithm>
 #include <cctype>
+#include <limits>
 
 namespace chronos {
 
@@ -15,12 +17,15 @@ CLIOptions CLIParser::parse(int argc, char* argv[]) {
         return options;
     }
 
+    // Set by the DVFS and placement options
+    bool power_flags = false;
+
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
 
         if (arg == "--algo" || arg == "-a") {
             if (i + 1 >= argc) { 
-                std::cerr << "Error: --algo requires a value (FCFS, SJF, Priority, RR)\n";
+                std::cerr << "Error: --algo requires a value (FCFS, SJF, Priority, RR, MLFQ, CFS, SRTF, PPriority, EDF)\n";
                 return options;
             }
 
@@ -28,7 +33,7 @@ CLIOptions CLIParser::parse(int argc, char* argv[]) {
             auto algorithm = stringToAlgorithm(algorithm_str);
             if (!algorithm.has_value()) {
                 std::cerr << "Error: Invalid algorithm: '" << algorithm_str << 
-                "' Must be one of FCFS, SJF, Priority, RR" << std::endl;
+                "' Must be one of FCFS, SJF, Priority, RR, MLFQ, CFS, SRTF, PPriority, EDF" << std::endl;
                 return options;
             }
 
@@ -95,18 +100,691 @@ CLIOptions CLIParser::parse(int argc, char* argv[]) {
                 return options;
             }
         }
+        else if (arg == "--engine" || arg == "-e") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --engine requires a value (threaded, event)\n";
+                return options;
+            }
+
+            std::string engine_str = argv[++i];
+            auto engine = stringToEngineMode(engine_str);
+            if (!engine.has_value()) {
+                std::cerr << "Error: Invalid engine: '" << engine_str
+                          << "' Must be one of threaded, event\n";
+                return options;
+            }
+
+            options.engine.mode = engine.value();
+        }
+        else if (arg == "--queues") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --queues requires a value (global, per-core)\n";
+                return options;
+            }
+
+            std::string queues_str = argv[++i];
+            auto queue_mode = stringToQueueMode(queues_str);
+            if (!queue_mode.has_value()) {
+                std::cerr << "Error: Invalid queue mode: '" << queues_str
+                          << "' Must be one of global, per-core\n";
+                return options;
+            }
+
+            options.engine.queue_mode = queue_mode.value();
+        }
+        else if (arg == "--dispatch") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --dispatch requires a value (static, virtual)\n";
+                return options;
+            }
+
+            std::string dispatch_str = argv[++i];
+            auto dispatch = stringToDispatchMode(dispatch_str);
+            if (!dispatch.has_value()) {
+                std::cerr << "Error: Invalid dispatch mode: '" << dispatch_str
+                          << "' Must be one of static, virtual\n";
+                return options;
+            }
+
+            options.engine.dispatch = dispatch.value();
+        }
+        else if (arg == "--placement") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --placement requires a value (rr, least-loaded, soft, hard, numa)\n";
+                return options;
+            }
+
+            std::string placement_str = argv[++i];
+            auto placement = stringToPlacement(placement_str);
+            if (!placement.has_value()) {
+                std::cerr << "Error: Invalid placement: '" << placement_str
+                          << "' Must be one of rr, least-loaded, soft, hard, numa\n";
+                return options;
+            }
+
+            options.engine.placement = placement.value();
+        }
+        else if (arg == "--sockets") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --sockets requires a value\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            try {
+                options.engine.topology.sockets = std::stoi(value_str);
+            } catch (const std::exception& e) {
+                options.engine.topology.sockets = 0;
+            }
+            if (options.engine.topology.sockets <= 0) {
+                std::cerr << "Error: --sockets value '" << value_str
+                          << "' must be a positive integer\n";
+                return options;
+            }
+        }
+        else if (arg == "--switch-cost" || arg == "--migration-cost" || arg == "--cross-socket-cost") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires a value (seconds)\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            float cost = -1.0f;
+            try {
+                cost = std::stof(value_str);
+            } catch (const std::exception& e) {
+                cost = -1.0f;
+            }
+            if (!(cost >= 0.0f)) {
+                std::cerr << "Error: " << arg << " value '" << value_str
+                          << "' must be a non-negative number of seconds\n";
+                return options;
+            }
+
+            if (arg == "--switch-cost") {
+                options.engine.cost.dispatch_overhead = cost;
+            } else if (arg == "--migration-cost") {
+                options.engine.cost.migration_penalty = cost;
+            } else {
+                options.engine.cost.cross_socket_penalty = cost;
+            }
+        }
+        else if (arg == "--io-depth") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --io-depth requires a value\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            try {
+                options.engine.io_depth = std::stoi(value_str);
+            } catch (const std::exception& e) {
+                options.engine.io_depth = 0;
+            }
+            if (options.engine.io_depth <= 0) {
+                std::cerr << "Error: --io-depth value '" << value_str
+                          << "' must be a positive integer\n";
+                return options;
+            }
+        }
+        else if (arg == "--io-mix") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --io-mix requires a value (fraction of jobs, 0-1)\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            try {
+                options.io_mix = std::stof(value_str);
+            } catch (const std::exception& e) {
+                options.io_mix = -1.0f;
+            }
+            if (!(options.io_mix >= 0.0f && options.io_mix <= 1.0f)) {
+                std::cerr << "Error: --io-mix value '" << value_str
+                          << "' must be a fraction between 0 and 1\n";
+                return options;
+            }
+        }
+        else if (arg == "--execute") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --execute requires a value (sleep, spin, stream, chase)\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            auto mode = CpuKernel::stringToMode(value_str);
+            if (!mode.has_value()) {
+                std::cerr << "Error: Unknown execution mode: " << value_str << "\n";
+                std::cerr << "Valid options: sleep, spin, stream, chase\n";
+                return options;
+            }
+            options.engine.execution.mode = mode.value();
+        }
+        else if (arg == "--time-scale") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --time-scale requires a value (wall seconds per simulated second)\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            try {
+                options.engine.execution.time_scale = std::stod(value_str);
+            } catch (const std::exception& e) {
+                options.engine.execution.time_scale = -1.0;
+            }
+            if (!(options.engine.execution.time_scale > 0.0)) {
+                std::cerr << "Error: --time-scale value '" << value_str
+                          << "' must be a positive number\n";
+                return options;
+            }
+        }
+        else if (arg == "--working-set") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --working-set requires a value (KB per core)\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            int kilobytes = 0;
+            try {
+                kilobytes = std::stoi(value_str);
+            } catch (const std::exception& e) {
+                kilobytes = 0;
+            }
+            if (kilobytes <= 0) {
+                std::cerr << "Error: --working-set value '" << value_str
+                          << "' must be a positive number of KB\n";
+                return options;
+            }
+            options.engine.execution.working_set = static_cast<std::size_t>(kilobytes) * 1024;
+        }
+        else if (arg == "--no-pin") {
+            options.engine.execution.pin_threads = false;
+        }
+        else if (arg == "--live") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --live requires a target (stderr or unix:PATH)\n";
+                return options;
+            }
+
+            options.live_target = argv[++i];
+            if (options.live_target != "stderr" && options.live_target.compare(0, 5, "unix:") != 0) {
+                std::cerr << "Error: Unknown live stats target: " << options.live_target
+                          << " (stderr or unix:PATH)\n";
+                return options;
+            }
+        }
+        else if (arg == "--live-interval") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --live-interval requires a value (milliseconds)\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            try {
+                options.live_interval_ms = std::stoi(value_str);
+            } catch (const std::exception& e) {
+                options.live_interval_ms = 0;
+            }
+            if (options.live_interval_ms <= 0) {
+                std::cerr << "Error: --live-interval value '" << value_str
+                          << "' must be a positive number of milliseconds\n";
+                return options;
+            }
+        }
+        else if (arg == "--arrivals" || arg == "--service") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires a value ("
+                          << (arg == "--arrivals" ? "poisson, mmpp, diurnal"
+                                                  : "uniform, pareto, lognormal, bimodal")
+                          << ")\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            if (arg == "--arrivals") {
+                auto model = WorkloadGenerator::stringToArrival(value_str);
+                if (!model.has_value()) {
+                    std::cerr << "Error: Unknown arrival model: " << value_str << "\n";
+                    return options;
+                }
+                options.generator.arrivals = model.value();
+            } else {
+                auto model = WorkloadGenerator::stringToService(value_str);
+                if (!model.has_value()) {
+                    std::cerr << "Error: Unknown service model: " << value_str << "\n";
+                    return options;
+                }
+                options.generator.service = model.value();
+            }
+            options.use_generator = true;
+        }
+        else if (arg == "--rate" || arg == "--service-mean" || arg == "--pareto-alpha") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires a value\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            double value = -1.0;
+            try {
+                value = std::stod(value_str);
+            } catch (const std::exception& e) {
+                value = -1.0;
+            }
+            const double minimum = arg == "--pareto-alpha" ? 1.0 : 0.0;
+            if (!(value > minimum)) {
+                std::cerr << "Error: " << arg << " value '" << value_str
+                          << "' must be a number greater than " << minimum << "\n";
+                return options;
+            }
+
+            if (arg == "--rate") {
+                options.arrival_rate = value;
+            } else if (arg == "--service-mean") {
+                options.generator.service_mean = value;
+            } else {
+                options.generator.pareto_alpha = value;
+            }
+            options.use_generator = true;
+        }
+        else if (arg == "--tenants") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --tenants requires a value (e.g. 70:4-5,30:1-3)\n";
+                return options;
+            }
+            options.generator.tenants.clear();
+            if (!WorkloadGenerator::parseTenants(argv[++i], options.generator.tenants)) {
+                return options;
+            }
+            options.use_generator = true;
+        }
+        else if (arg == "--slo-mix") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --slo-mix requires a value (e.g. 20,60,20)\n";
+                return options;
+            }
+            // Shares of critical, standard and best-effort jobs; zeros allowed
+            std::stringstream list(argv[++i]);
+            std::string item;
+            options.generator.slo_mix.clear();
+            while (std::getline(list, item, ',')) {
+                double share = -1.0;
+                try {
+                    share = std::stod(item);
+                } catch (const std::exception& e) {
+                    share = -1.0;
+                }
+                if (!(share >= 0.0)) {
+                    std::cerr << "Error: --slo-mix value '" << item
+                              << "' must be a non-negative number\n";
+                    return options;
+                }
+                options.generator.slo_mix.push_back(share);
+            }
+            options.use_generator = true;
+        }
+        else if (arg == "--deadline-slack") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --deadline-slack requires a value\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            double value = -1.0;
+            try {
+                value = std::stod(value_str);
+            } catch (const std::exception& e) {
+                value = -1.0;
+            }
+            if (!(value > 0.0)) {
+                std::cerr << "Error: --deadline-slack value '" << value_str
+                          << "' must be a number greater than 0\n";
+                return options;
+            }
+            options.generator.deadline_slack = value;
+            options.use_generator = true;
+        }
+        else if (arg == "--admission") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --admission requires a value (queue:N, token:RATE[:BURST], wait[:SEC])\n";
+                return options;
+            }
+            if (!parseAdmission(argv[++i], options.engine.admission)) {
+                return options;
+            }
+        }
+        else if (arg == "--admission-action") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --admission-action requires a value (reject or downgrade)\n";
+                return options;
+            }
+            std::string action = argv[++i];
+            std::transform(action.begin(), action.end(), action.begin(),
+                           [](unsigned char c) { return std::toupper(c); });
+            if (action == "REJECT") {
+                options.engine.admission.action = AdmissionAction::REJECT;
+            } else if (action == "DOWNGRADE") {
+                options.engine.admission.action = AdmissionAction::DOWNGRADE;
+            } else {
+                std::cerr << "Error: Invalid admission action: '" << argv[i]
+                          << "' Must be reject or downgrade\n";
+                return options;
+            }
+        }
+        else if (arg == "--core-types") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --core-types requires a value (e.g. 2xbig,2xlittle)\n";
+                return options;
+            }
+            options.engine.power.cores.clear();
+            if (!parseCoreTypes(argv[++i], options.engine.power.cores)) {
+                return options;
+            }
+        }
+        else if (arg == "--dvfs") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --dvfs requires a value (e.g. 0.6,0.8,1.0)\n";
+                return options;
+            }
+            // Frequency levels as fractions of each core's full speed
+            std::vector<double> levels;
+            if (!parseWeightList(argv[++i], arg, levels)) {
+                return options;
+            }
+            std::sort(levels.begin(), levels.end());
+            if (levels.back() > 1.0) {
+                std::cerr << "Error: --dvfs levels must be fractions of full frequency (at most 1)\n";
+                return options;
+            }
+            options.engine.power.frequencies.assign(levels.begin(), levels.end());
+            power_flags = true;
+        }
+        else if (arg == "--governor") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --governor requires a value (performance, powersave or ondemand)\n";
+                return options;
+            }
+            const auto governor = stringToGovernor(argv[++i]);
+            if (!governor) {
+                std::cerr << "Error: Invalid governor: '" << argv[i]
+                          << "' Must be performance, powersave or ondemand\n";
+                return options;
+            }
+            options.engine.power.governor = *governor;
+            power_flags = true;
+        }
+        else if (arg == "--dvfs-latency") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --dvfs-latency requires a value\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            double value = -1.0;
+            try {
+                value = std::stod(value_str);
+            } catch (const std::exception& e) {
+                value = -1.0;
+            }
+            if (!(value >= 0.0)) {
+                std::cerr << "Error: --dvfs-latency value '" << value_str
+                          << "' must be a non-negative number of seconds\n";
+                return options;
+            }
+            options.engine.power.transition_latency = static_cast<float>(value);
+            power_flags = true;
+        }
+        else if (arg == "--energy-placement") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --energy-placement requires a value (in-order, fastest, efficient or energy)\n";
+                return options;
+            }
+            const auto placement = stringToEnergyPlacement(argv[++i]);
+            if (!placement) {
+                std::cerr << "Error: Invalid energy placement: '" << argv[i]
+                          << "' Must be in-order, fastest, efficient or energy\n";
+                return options;
+            }
+            options.engine.power.placement = *placement;
+            power_flags = true;
+        }
+        else if (arg == "--fair-share") {
+            options.fair_share = true;
+        }
+        else if (arg == "--tenant-weights") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --tenant-weights requires a value (e.g. 3,1,1)\n";
+                return options;
+            }
+            options.tenant_weights.clear();
+            if (!parseWeightList(argv[++i], arg, options.tenant_weights)) {
+                return options;
+            }
+            options.fair_share = true;
+        }
+        else if (arg == "--generate-only") {
+            options.generate_only = true;
+        }
         else if (arg == "--compare-all" || arg == "--compare") {
             options.compare_all = true;
             options.algorithm = static_cast<SchedulingAlgorithm>(-1); // use sentinel value (-1) to represent "All" algorithms
         }
+        else if (arg == "--seed") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --seed requires a value\n";
+                return options;
+            }
+
+            unsigned int seed = 0;
+            if (!parseSeed(argv[++i], "--seed", seed)) {
+                return options;
+            }
+            options.seed = seed;
+        }
+        else if (arg == "--sweep") {
+            options.sweep = true;
+            options.algorithm = static_cast<SchedulingAlgorithm>(-1); // same "All" sentinel as --compare-all
+        }
+        else if (arg == "--sweep-algos") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --sweep-algos requires a value (e.g. FCFS,SJF,RR)\n";
+                return options;
+            }
+
+            std::stringstream list(argv[++i]);
+            std::string item;
+            while (std::getline(list, item, ',')) {
+                auto algorithm = stringToAlgorithm(item);
+                if (!algorithm.has_value()) {
+                    std::cerr << "Error: Invalid algorithm in --sweep-algos: '" << item << "'\n";
+                    return options;
+                }
+                options.sweep_algorithms.push_back(algorithm.value());
+            }
+        }
+        else if (arg == "--seeds") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --seeds requires a comma-separated list\n";
+                return options;
+            }
+
+            // Any value --seed takes, 0 included
+            std::stringstream list(argv[++i]);
+            std::string item;
+            options.sweep_seeds.clear();
+            while (std::getline(list, item, ',')) {
+                unsigned int seed = 0;
+                if (!parseSeed(item, "--seeds", seed)) {
+                    return options;
+                }
+                options.sweep_seeds.push_back(seed);
+            }
+            if (options.sweep_seeds.empty()) {
+                std::cerr << "Error: --seeds requires at least one value\n";
+                return options;
+            }
+        }
+        else if (arg == "--sweep-cores" || arg == "--sweep-quanta") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires a comma-separated list\n";
+                return options;
+            }
+
+            std::vector<int> values;
+            if (!parseIntList(argv[++i], arg, values)) {
+                return options;
+            }
+            if (arg == "--sweep-cores") {
+                options.sweep_cores = values;
+            } else {
+                options.sweep_quanta = values;
+            }
+        }
+        else if (arg == "--threads") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --threads requires a value\n";
+                return options;
+            }
+
+            std::string value_str = argv[++i];
+            try {
+                int threads = std::stoi(value_str);
+                if (threads <= 0) {
+                    std::cerr << "Error: --threads must be a positive integer\n";
+                    return options;
+                }
+                options.threads = threads;
+            } catch (const std::exception& e) {
+                std::cerr << "Error: --threads value '" << value_str
+                          << "' is not a valid integer\n";
+                return options;
+            }
+        }
+        else if (arg == "--workload" || arg == "-w" || arg == "--save-workload") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires a file path\n";
+                return options;
+            }
+            if (arg == "--save-workload") {
+                options.save_workload = argv[++i];
+            } else {
+                options.workload_file = argv[++i];
+            }
+        }
+        else if (arg == "--trace") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: --trace requires a file path\n";
+                return options;
+            }
+            options.trace_file = argv[++i];
+        }
+        else if (arg == "--trace-mmap") {
+            options.trace_mmap = true;
+        }
+        else if (arg == "--job-table") {
+            options.engine.job_table_rows = std::numeric_limits<std::size_t>::max();
+        }
+        else if (arg == "--deterministic") {
+            options.engine.deterministic = true;
+        }
+        else if (arg == "--record" || arg == "--replay") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires a file path\n";
+                return options;
+            }
+            (arg == "--record" ? options.record_file : options.replay_file) = argv[++i];
+            options.engine.deterministic = true;
+        }
         else if (arg == "--help" || arg == "-h") {
             std::cout << "Usage: schedsim [OPTIONS]\n"
                       << "Options:\n"
-                      << "  --algo, -a <ALGO>       Scheduling algorithm (FCFS, SJF, Priority, RR)\n"
+                      << "  --algo, -a <ALGO>       Scheduling algorithm (FCFS, SJF, Priority, RR,\n"
+                      << "                          MLFQ, CFS, SRTF, PPriority, EDF)\n"
                       << "  --cores, -c <NUM>       Number of CPU cores (positive integer)\n"
-                      << "  --jobs, -j <NUM>        Number of jobs (positive integer)\n"
+                      << "  --jobs, -j <NUM>        Number of jobs (positive integer; with --workload, max jobs to read)\n"
                       << "  --quantum, -q <NUM>     Time quantum for Round Robin (positive integer, optional)\n"
+                      << "                          (MLFQ base quantum, CFS target latency)\n"
+                      << "  --engine, -e <ENGINE>   Execution engine: threaded (default) or event\n"
+                      << "                          (discrete-event simulation on a virtual clock)\n"
+                      << "  --dispatch <MODE>       Event engine policy calls: static (default; built-in\n"
+                      << "                          policies inlined into the event loop) or virtual\n"
+                      << "  --queues <MODE>         Threaded engine ready queues: global (default) or per-core\n"
+                      << "                          (per-core run queues with work stealing)\n"
+                      << "  --placement <POLICY>    Per-core placement: rr (default), least-loaded,\n"
+                      << "                          soft (affinity), hard (pinned) or numa (node-local)\n"
+                      << "  --sockets <NUM>         Group the cores into NUM sockets / NUMA nodes (default 1)\n"
+                      << "  --switch-cost <SEC>     Core time charged for every dispatch (default 0)\n"
+                      << "  --migration-cost <SEC>  Cache warm-up charged when a job resumes on a\n"
+                      << "                          different core than last time (default 0)\n"
+                      << "  --cross-socket-cost <SEC> Extra warm-up when that core is on another socket\n"
+                      << "  --io-depth <NUM>        I/O requests the device services at once (default 1)\n"
+                      << "  --io-mix <FRACTION>     Share of generated jobs that are I/O-bound, with\n"
+                      << "                          CPU bursts split by I/O bursts (default 0)\n"
+                      << "  --execute <MODE>        Threaded engine slices: sleep (default), or run a\n"
+                      << "                          calibrated spin, stream or chase kernel on pinned threads\n"
+                      << "  --time-scale <FACTOR>   Real execution: wall seconds per simulated second (default 1)\n"
+                      << "  --working-set <KB>      Real execution: stream/chase buffer per core (default 8192)\n"
+                      << "  --no-pin                Real execution: leave worker threads unpinned\n"
+                      << "  --arrivals <MODEL>      Generated arrivals: poisson (default), mmpp (bursty)\n"
+                      << "                          or diurnal (sinusoidal rate)\n"
+                      << "  --rate <JOBS/SEC>       Mean arrival rate (default: 80% load on --cores)\n"
+                      << "  --service <MODEL>       Generated CPU demand: uniform (default), pareto,\n"
+                      << "                          lognormal or bimodal\n"
+                      << "  --service-mean <SEC>    Mean CPU demand per job (default 5.5)\n"
+                      << "  --pareto-alpha <NUM>    Pareto tail index, > 1; smaller is heavier (default 1.5)\n"
+                      << "  --tenants <LIST>        Tenant priority mixes, WEIGHT:MIN-MAX each\n"
+                      << "                          (e.g. 70:4-5,30:1-3; default one tenant, 1-5)\n"
+                      << "  --slo-mix <C,S,B>       Shares of critical, standard and best-effort jobs\n"
+                      << "                          (default: all standard)\n"
+                      << "  --deadline-slack <X>    Give generated jobs deadlines of arrival + service x\n"
+                      << "                          (1 + X); X/2 for critical jobs, none for best-effort\n"
+                      << "  --admission <SPEC>      Screen arrivals: queue:N (at most N waiting),\n"
+                      << "                          token:RATE[:BURST] (jobs/s) or wait[:SEC] (predicted\n"
+                      << "                          wait meets the deadline, or is at most SEC)\n"
+                      << "  --admission-action <A>  Failed arrivals: reject (default) or downgrade\n"
+                      << "                          (run as best-effort; EDF runs those last)\n"
+                      << "  --core-types <LIST>     Event engine core speeds and power, COUNTxTYPE each:\n"
+                      << "                          big (speed 1, 3 W active, 0.3 W idle), little\n"
+                      << "                          (0.5, 0.6 W, 0.05 W) or SPEED:ACTIVE_W:IDLE_W\n"
+                      << "                          (e.g. 2xbig,2xlittle; reports joules and perf/W)\n"
+                      << "  --dvfs <LIST>           Frequency levels as fractions of full speed\n"
+                      << "                          (e.g. 0.5,0.75,1; default 1)\n"
+                      << "  --governor <GOV>        DVFS level per slice: performance (default),\n"
+                      << "                          powersave or ondemand (lowest level covering load)\n"
+                      << "  --dvfs-latency <SEC>    Core stall on every frequency change (default 0)\n"
+                      << "  --energy-placement <P>  Idle core for the next job: in-order (default),\n"
+                      << "                          fastest, efficient or energy (most efficient core\n"
+                      << "                          that meets the job's deadline)\n"
+                      << "  --fair-share            Share the cores between tenants by weighted fair\n"
+                      << "                          queueing, running --algo inside each tenant\n"
+                      << "  --tenant-weights <LIST> Tenant 0, 1, ... fair-share weights (default 1 each;\n"
+                      << "                          implies --fair-share)\n"
+                      << "  --generate-only         Write --save-workload and exit without simulating\n"
                       << "  --compare-all           Run all algorithms and compare results\n"
+                      << "  --seed <NUM>            Fixed seed for job generation (reproducible runs)\n"
+                      << "  --sweep                 Run an algorithm x cores x quantum x seed grid in parallel\n"
+                      << "  --sweep-algos <LIST>    Algorithms to sweep (default: all)\n"
+                      << "  --sweep-cores <LIST>    Core counts to sweep (default: --cores)\n"
+                      << "  --sweep-quanta <LIST>   RR/MLFQ/CFS quanta to sweep (default: --quantum or 2)\n"
+                      << "  --seeds <LIST>          Workload seeds to sweep (default: --seed or 1)\n"
+                      << "  --threads <NUM>         Sweep worker threads (default: all hardware threads)\n"
+                      << "  --workload, -w <FILE>   Replay jobs from a CSV or binary workload file\n"
+                      << "  --save-workload <FILE>  Save the job set as a binary workload file\n"
+                      << "  --trace <FILE>          Write a binary event trace of the run to FILE\n"
+                      << "                          (convert with tools/trace_to_csv.py)\n"
+                      << "  --trace-mmap            Write the trace through a memory-mapped file\n"
+                      << "  --job-table             Print every job after the run (default: only\n"
+                      << "                          runs of at most 50 jobs)\n"
+                      << "  --deterministic         Threaded engine: take every scheduling decision in\n"
+                      << "                          simulated-time order, so runs repeat exactly (seed 1\n"
+                      << "                          unless --seed is given)\n"
+                      << "  --record <FILE>         Write the run's dispatch log to FILE (implies --deterministic)\n"
+                      << "  --replay <FILE>         Check every dispatch against a recorded log and report\n"
+                      << "                          the first that differs (implies --deterministic)\n"
+                      << "  --live <TARGET>         Publish live stats while running, one JSON line per\n"
+                      << "                          interval, to stderr or unix:PATH (a stream socket)\n"
+                      << "  --live-interval <MS>    Live stats interval in milliseconds (default 1000)\n"
                       << "  --help, -h              Show this help message\n";
             options.is_valid = false;  // Help doesn't run the program
             return options;
@@ -118,6 +796,11 @@ CLIOptions CLIParser::parse(int argc, char* argv[]) {
         }
     }
 
+    // DVFS and placement options alone model identical big cores
+    if (power_flags && !options.engine.power.enabled()) {
+        options.engine.power.cores.push_back(CoreType::big());
+    }
+
     if (validateOptions(options)) {
         options.is_valid = true;
     }
@@ -138,6 +821,9 @@ void CLIParser::printOptions(const CLIOptions& options) {
     std::cout << "Algorithm: " << algorithmToString(options.algorithm) << "\n";
     std::cout << "CPU Cores: " << options.num_cores << "\n";
     std::cout << "Number of Jobs: " << options.num_jobs << "\n";
+    if (!options.workload_file.empty()) {
+        std::cout << "Workload: " << options.workload_file << "\n";
+    }
     
     if (options.quantum.has_value()) {
         std::cout << "Quantum: " << options.quantum.value() << "\n";
@@ -149,7 +835,89 @@ void CLIParser::printOptions(const CLIOptions& options) {
         std::cout << "\n";
     }
     
+    std::cout << "Engine: " << engineModeToString(options.engine.mode) << "\n";
+    std::cout << "Ready Queues: " << queueModeToString(options.engine.queue_mode) << "\n";
+    if (options.engine.mode == EngineMode::DISCRETE_EVENT) {
+        std::cout << "Policy Dispatch: " << dispatchModeToString(options.engine.dispatch) << "\n";
+    }
+    if (options.engine.execution.real()) {
+        std::cout << "Execution: " << CpuKernel::modeToString(options.engine.execution.mode)
+                  << " kernel x" << options.engine.execution.time_scale
+                  << (options.engine.execution.pin_threads ? ", pinned" : "") << "\n";
+    }
+    if (options.engine.queue_mode == QueueMode::PER_CORE) {
+        std::cout << "Placement: " << placementToString(options.engine.placement) << "\n";
+    }
+    if (options.engine.topology.sockets > 1) {
+        std::cout << "Sockets: " << options.engine.topology.sockets << "\n";
+    }
+    if (options.engine.cost.enabled()) {
+        std::cout << "Switch Cost: " << options.engine.cost.dispatch_overhead
+                  << " | Migration Cost: " << options.engine.cost.migration_penalty << "\n";
+    }
+    if (options.use_generator && options.workload_file.empty()) {
+        std::cout << "Generator: " << WorkloadGenerator::arrivalToString(options.generator.arrivals)
+                  << " arrivals, " << WorkloadGenerator::serviceToString(options.generator.service)
+                  << " service (mean " << options.generator.service_mean << ")\n";
+    }
+    if (options.use_generator && options.workload_file.empty() &&
+        (!options.generator.slo_mix.empty() || options.generator.deadline_slack > 0.0)) {
+        std::cout << "Deadline Slack: " << options.generator.deadline_slack;
+        if (!options.generator.slo_mix.empty()) {
+            std::cout << " | SLO Mix: ";
+            for (std::size_t c = 0; c < options.generator.slo_mix.size(); ++c) {
+                std::cout << (c ? "," : "") << options.generator.slo_mix[c];
+            }
+        }
+        std::cout << "\n";
+    }
+    if (options.engine.admission.enabled()) {
+        std::cout << "Admission: " << admissionToString(options.engine.admission) << "\n";
+    }
+    if (options.engine.power.enabled()) {
+        const PowerConfig& power = options.engine.power;
+        std::cout << "Core Types: " << coreTypesToString(power.cores) << "\n";
+        std::cout << "DVFS Levels: ";
+        for (std::size_t l = 0; l < power.frequencies.size(); ++l) {
+            std::cout << (l ? "," : "") << power.frequencies[l];
+        }
+        std::cout << " | Governor: " << governorToString(power.governor)
+                  << " | Latency: " << power.transition_latency
+                  << " | Placement: " << energyPlacementToString(power.placement) << "\n";
+    }
+    if (options.io_mix > 0.0f) {
+        std::cout << "I/O-bound Jobs: " << options.io_mix * 100.0f << "%\n";
+    }
+    if (options.io_mix > 0.0f || options.engine.io_depth > 1) {
+        std::cout << "I/O Depth: " << options.engine.io_depth << "\n";
+    }
+    if (options.fair_share) {
+        std::cout << "Fair Share: Yes";
+        if (!options.tenant_weights.empty()) {
+            std::cout << " | Weights: ";
+            for (std::size_t t = 0; t < options.tenant_weights.size(); ++t) {
+                std::cout << (t ? "," : "") << options.tenant_weights[t];
+            }
+        }
+        std::cout << "\n";
+    }
     std::cout << "Compare All: " << (options.compare_all ? "Yes" : "No") << "\n";
+    std::cout << "Sweep: " << (options.sweep ? "Yes" : "No") << "\n";
+    std::cout << "Trace: " << (options.trace_file.empty() ? "None" : options.trace_file) << "\n";
+    if (options.engine.deterministic && options.engine.mode == EngineMode::THREADED) {
+        std::cout << "Deterministic: Yes";
+        if (!options.record_file.empty()) {
+            std::cout << " | Record: " << options.record_file;
+        }
+        if (!options.replay_file.empty()) {
+            std::cout << " | Replay: " << options.replay_file;
+        }
+        std::cout << "\n";
+    }
+    if (!options.live_target.empty()) {
+        std::cout << "Live Stats: " << options.live_target << " every " << options.live_interval_ms
+                  << " ms\n";
+    }
     std::cout << "========================================\n";
 }
 
@@ -159,6 +927,11 @@ std::string CLIParser::algorithmToString(const SchedulingAlgorithm& algo) {
         case SchedulingAlgorithm::SJF:      return "SJF";
         case SchedulingAlgorithm::PRIORITY: return "Priority";
         case SchedulingAlgorithm::RR:       return "Round Robin";
+        case SchedulingAlgorithm::MLFQ:     return "MLFQ";
+        case SchedulingAlgorithm::CFS:      return "CFS";
+        case SchedulingAlgorithm::SRTF:     return "SRTF";
+        case SchedulingAlgorithm::PRIORITY_PREEMPTIVE: return "Preemptive Priority";
+        case SchedulingAlgorithm::EDF:      return "EDF";
         default:                            return "All";
     }
 }
@@ -177,11 +950,305 @@ std::optional<SchedulingAlgorithm> CLIParser::stringToAlgorithm(const std::strin
         return SchedulingAlgorithm::PRIORITY;
     } else if (upper_str == "RR" || upper_str == "ROUNDROBIN") {
         return SchedulingAlgorithm::RR;
+    } else if (upper_str == "MLFQ") {
+        return SchedulingAlgorithm::MLFQ;
+    } else if (upper_str == "CFS") {
+        return SchedulingAlgorithm::CFS;
+    } else if (upper_str == "SRTF") {
+        return SchedulingAlgorithm::SRTF;
+    } else if (upper_str == "PPRIORITY" || upper_str == "PPRI") {
+        return SchedulingAlgorithm::PRIORITY_PREEMPTIVE;
+    } else if (upper_str == "EDF") {
+        return SchedulingAlgorithm::EDF;
     }
     
     return std::nullopt;
 }
 
+std::string CLIParser::engineModeToString(EngineMode mode) {
+    switch (mode) {
+        case EngineMode::THREADED:       return "Threaded";
+        case EngineMode::DISCRETE_EVENT: return "Discrete Event";
+        default:                         return "Unknown";
+    }
+}
+
+std::optional<EngineMode> CLIParser::stringToEngineMode(const std::string& str) {
+    std::string upper_str = str;
+    std::transform(upper_str.begin(), upper_str.end(), upper_str.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+
+    if (upper_str == "THREADED" || upper_str == "THREADS") {
+        return EngineMode::THREADED;
+    } else if (upper_str == "EVENT" || upper_str == "DES" || upper_str == "SIM") {
+        return EngineMode::DISCRETE_EVENT;
+    }
+
+    return std::nullopt;
+}
+
+std::string CLIParser::queueModeToString(QueueMode mode) {
+    switch (mode) {
+        case QueueMode::GLOBAL:   return "Global";
+        case QueueMode::PER_CORE: return "Per-Core";
+        default:                  return "Unknown";
+    }
+}
+
+std::optional<QueueMode> CLIParser::stringToQueueMode(const std::string& str) {
+    std::string upper_str = str;
+    std::transform(upper_str.begin(), upper_str.end(), upper_str.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+
+    if (upper_str == "GLOBAL") {
+        return QueueMode::GLOBAL;
+    } else if (upper_str == "PER-CORE" || upper_str == "PERCORE" || upper_str == "LOCAL") {
+        return QueueMode::PER_CORE;
+    }
+
+    return std::nullopt;
+}
+
+std::string CLIParser::dispatchModeToString(DispatchMode mode) {
+    switch (mode) {
+        case DispatchMode::STATIC:  return "Static";
+        case DispatchMode::VIRTUAL: return "Virtual";
+        default:                    return "Unknown";
+    }
+}
+
+std::optional<DispatchMode> CLIParser::stringToDispatchMode(const std::string& str) {
+    std::string upper_str = str;
+    std::transform(upper_str.begin(), upper_str.end(), upper_str.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+
+    if (upper_str == "STATIC") {
+        return DispatchMode::STATIC;
+    } else if (upper_str == "VIRTUAL" || upper_str == "DYNAMIC") {
+        return DispatchMode::VIRTUAL;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<PlacementStrategy> CLIParser::stringToPlacement(const std::string& str) {
+    std::string upper_str = str;
+    std::transform(upper_str.begin(), upper_str.end(), upper_str.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+
+    if (upper_str == "RR" || upper_str == "ROUNDROBIN") {
+        return PlacementStrategy::ROUND_ROBIN;
+    } else if (upper_str == "LEAST-LOADED" || upper_str == "LEASTLOADED" || upper_str == "LL") {
+        return PlacementStrategy::LEAST_LOADED;
+    } else if (upper_str == "SOFT" || upper_str == "SOFT-AFFINITY") {
+        return PlacementStrategy::SOFT_AFFINITY;
+    } else if (upper_str == "HARD" || upper_str == "HARD-AFFINITY" || upper_str == "PINNED") {
+        return PlacementStrategy::HARD_AFFINITY;
+    } else if (upper_str == "NUMA" || upper_str == "NUMA-LOCAL") {
+        return PlacementStrategy::NUMA_LOCAL;
+    }
+
+    return std::nullopt;
+}
+
+std::string CLIParser::placementToString(PlacementStrategy strategy) {
+    switch (strategy) {
+        case PlacementStrategy::ROUND_ROBIN:   return "rr";
+        case PlacementStrategy::LEAST_LOADED:  return "least-loaded";
+        case PlacementStrategy::SOFT_AFFINITY: return "soft";
+        case PlacementStrategy::HARD_AFFINITY: return "hard";
+        case PlacementStrategy::NUMA_LOCAL:    return "numa";
+        default:                               return "unknown";
+    }
+}
+
+bool CLIParser::parseIntList(const std::string& str, const std::string& flag, std::vector<int>& values) {
+    std::stringstream list(str);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        try {
+            int value = std::stoi(item);
+            if (value <= 0) {
+                std::cerr << "Error: " << flag << " values must be positive integers\n";
+                return false;
+            }
+            values.push_back(value);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << flag << " value '" << item
+                      << "' is not a valid integer\n";
+            return false;
+        }
+    }
+
+    if (values.empty()) {
+        std::cerr << "Error: " << flag << " requires at least one value\n";
+        return false;
+    }
+    return true;
+}
+
+bool CLIParser::parseSeed(const std::string& str, const std::string& flag, unsigned int& seed) {
+    // stoul alone would wrap "-1" and truncate values past 32 bits
+    const bool digits = !str.empty() && std::all_of(str.begin(), str.end(), [](char c) {
+        return std::isdigit(static_cast<unsigned char>(c)) != 0;
+    });
+    unsigned long long value = 0;
+    try {
+        value = digits ? std::stoull(str) : 0;
+    } catch (const std::exception& e) {
+        value = std::numeric_limits<unsigned long long>::max();
+    }
+    if (!digits || value > std::numeric_limits<unsigned int>::max()) {
+        std::cerr << "Error: " << flag << " value '" << str << "' is not a valid seed (0-"
+                  << std::numeric_limits<unsigned int>::max() << ")\n";
+        return false;
+    }
+    seed = static_cast<unsigned int>(value);
+    return true;
+}
+
+bool CLIParser::parseWeightList(const std::string& str, const std::string& flag,
+                                std::vector<double>& values) {
+    std::stringstream list(str);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        try {
+            double value = std::stod(item);
+            if (!(value > 0.0)) {
+                std::cerr << "Error: " << flag << " values must be positive\n";
+                return false;
+            }
+            values.push_back(value);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << flag << " value '" << item
+                      << "' is not a valid number\n";
+            return false;
+        }
+    }
+
+    if (values.empty()) {
+        std::cerr << "Error: " << flag << " requires at least one value\n";
+        return false;
+    }
+    if (values.size() > static_cast<std::size_t>(MAX_TENANT) + 1) {
+        std::cerr << "Error: " << flag << " takes at most " << MAX_TENANT + 1 << " weights\n";
+        return false;
+    }
+    return true;
+}
+
+bool CLIParser::parseCoreTypes(const std::string& str, std::vector<CoreType>& cores) {
+    std::stringstream list(str);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        // [COUNTx]TYPE
+        int count = 1;
+        std::string type = item;
+        const std::size_t x = item.find('x');
+        if (x != std::string::npos && x > 0 &&
+            std::all_of(item.begin(), item.begin() + static_cast<std::ptrdiff_t>(x),
+                        [](unsigned char c) { return std::isdigit(c); })) {
+            try {
+                count = std::stoi(item.substr(0, x));
+            } catch (const std::exception& e) {
+                count = 0;
+            }
+            type = item.substr(x + 1);
+        }
+
+        std::string upper_type = type;
+        std::transform(upper_type.begin(), upper_type.end(), upper_type.begin(),
+                       [](unsigned char c) { return std::toupper(c); });
+        CoreType core;
+        bool ok = count > 0;
+        if (upper_type == "BIG") {
+            core = CoreType::big();
+        } else if (upper_type == "LITTLE") {
+            core = CoreType::little();
+        } else {
+            std::vector<std::string> parts;
+            std::stringstream spec(type);
+            std::string part;
+            while (std::getline(spec, part, ':')) {
+                parts.push_back(part);
+            }
+            try {
+                ok = ok && parts.size() == 3;
+                if (ok) {
+                    core.name = type;
+                    core.speed = std::stof(parts[0]);
+                    core.active_watts = std::stof(parts[1]);
+                    core.idle_watts = std::stof(parts[2]);
+                    ok = core.speed > 0.0f && core.idle_watts >= 0.0f &&
+                         core.active_watts >= core.idle_watts;
+                }
+            } catch (const std::exception& e) {
+                ok = false;
+            }
+        }
+
+        if (!ok) {
+            std::cerr << "Error: Invalid --core-types entry '" << item << "' Must be COUNTxbig, "
+                      << "COUNTxlittle or COUNTxSPEED:ACTIVE_W:IDLE_W (SPEED > 0, "
+                      << "ACTIVE_W >= IDLE_W >= 0)\n";
+            return false;
+        }
+        cores.insert(cores.end(), static_cast<std::size_t>(count), core);
+    }
+
+    if (cores.empty()) {
+        std::cerr << "Error: --core-types requires at least one core\n";
+        return false;
+    }
+    return true;
+}
+
+bool CLIParser::parseAdmission(const std::string& str, AdmissionConfig& config) {
+    std::vector<std::string> parts;
+    std::stringstream spec(str);
+    std::string part;
+    while (std::getline(spec, part, ':')) {
+        parts.push_back(part);
+    }
+    std::string kind = parts.empty() ? std::string() : parts.front();
+    std::transform(kind.begin(), kind.end(), kind.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+
+    AdmissionConfig parsed = config;
+    bool ok = true;
+    try {
+        if (kind == "NONE" && parts.size() == 1) {
+            parsed.kind = AdmissionKind::NONE;
+        } else if (kind == "QUEUE" && parts.size() == 2) {
+            const int max_queued = std::stoi(parts[1]);
+            ok = max_queued > 0;
+            parsed.kind = AdmissionKind::QUEUE_LENGTH;
+            parsed.max_queued = static_cast<std::size_t>(std::max(0, max_queued));
+        } else if (kind == "TOKEN" && (parts.size() == 2 || parts.size() == 3)) {
+            parsed.kind = AdmissionKind::TOKEN_BUCKET;
+            parsed.rate = std::stod(parts[1]);
+            parsed.burst = parts.size() == 3 ? std::stod(parts[2]) : 1.0;
+            ok = parsed.rate > 0.0 && parsed.burst >= 1.0;
+        } else if (kind == "WAIT" && parts.size() <= 2) {
+            parsed.kind = AdmissionKind::PREDICTED_WAIT;
+            parsed.max_wait = parts.size() == 2 ? std::stod(parts[1]) : 0.0;
+            ok = parsed.max_wait >= 0.0;
+        } else {
+            ok = false;
+        }
+    } catch (const std::exception& e) {
+        ok = false;
+    }
+
+    if (!ok) {
+        std::cerr << "Error: Invalid --admission '" << str << "' Must be queue:N (N > 0), "
+                  << "token:RATE[:BURST] (RATE > 0, BURST >= 1), wait[:SEC] or none\n";
+        return false;
+    }
+    config = parsed;
+    return true;
+}
+
 bool CLIParser::validateOptions(const CLIOptions& options) {
     // Validate that required fields are set
     if (options.num_cores <= 0) {
@@ -189,7 +1256,7 @@ bool CLIParser::validateOptions(const CLIOptions& options) {
         return false;
     }
     
-    if (options.num_jobs <= 0) {
+    if (options.num_jobs <= 0 && options.workload_file.empty()) {
         std::cerr << "Error: --jobs is required and must be positive\n";
         return false;
     }
@@ -200,8 +1267,132 @@ bool CLIParser::validateOptions(const CLIOptions& options) {
         return false;
     }
     
-    if (!options.compare_all && options.quantum.has_value() && options.algorithm != SchedulingAlgorithm::RR) {
-        std::cout << "Warning: --quantum specified but algorithm is not Round Robin. "
+    if (options.engine.queue_mode == QueueMode::PER_CORE &&
+        options.engine.mode == EngineMode::DISCRETE_EVENT) {
+        std::cout << "Warning: --queues per-core only applies to the threaded engine. "
+                  << "It will be ignored.\n";
+    }
+
+    if (options.engine.dispatch == DispatchMode::VIRTUAL && options.engine.mode == EngineMode::THREADED) {
+        std::cout << "Warning: --dispatch only applies to the event engine. "
+                  << "It will be ignored.\n";
+    }
+
+    if (options.engine.execution.real() && options.engine.mode == EngineMode::DISCRETE_EVENT) {
+        std::cout << "Warning: --execute only applies to the threaded engine. "
+                  << "It will be ignored.\n";
+    }
+
+    if (options.engine.deterministic && options.engine.mode == EngineMode::DISCRETE_EVENT) {
+        std::cout << "Warning: --deterministic, --record and --replay only apply to the threaded "
+                  << "engine (the event engine always repeats exactly). They will be ignored.\n";
+    } else if (options.engine.deterministic && options.engine.queue_mode == QueueMode::PER_CORE) {
+        std::cout << "Warning: --deterministic runs on the global ready queue. "
+                  << "--queues per-core will be ignored.\n";
+    }
+
+    if ((!options.record_file.empty() || !options.replay_file.empty()) &&
+        (options.compare_all || options.sweep)) {
+        std::cout << "Warning: --record and --replay only apply to single-algorithm runs. "
+                  << "They will be ignored.\n";
+    }
+
+    if (options.fair_share && (options.compare_all || options.sweep)) {
+        std::cout << "Warning: --fair-share and --tenant-weights only apply to single-algorithm "
+                  << "runs. They will be ignored.\n";
+    }
+
+    if (!options.live_target.empty() && options.sweep) {
+        std::cout << "Warning: --live does not apply to --sweep (its runs are concurrent). "
+                  << "It will be ignored.\n";
+    }
+
+    if (options.engine.execution.real() && options.engine.execution.pin_threads && !options.sweep &&
+        options.num_cores > CpuKernel::availableCpus()) {
+        std::cout << "Warning: --cores " << options.num_cores << " exceeds the "
+                  << CpuKernel::availableCpus() << " host CPU(s) available; pinned cores will "
+                  << "share CPUs and measure as slowdown.\n";
+    }
+
+    const PlacementStrategy placement = options.engine.placement;
+    const bool affinity_placement = placement == PlacementStrategy::SOFT_AFFINITY ||
+                                    placement == PlacementStrategy::HARD_AFFINITY ||
+                                    placement == PlacementStrategy::NUMA_LOCAL;
+    if (affinity_placement && (options.engine.mode != EngineMode::THREADED ||
+                               options.engine.queue_mode != QueueMode::PER_CORE)) {
+        std::cout << "Warning: --placement " << placementToString(placement)
+                  << " only applies to the threaded engine with --queues per-core. "
+                  << "It will be ignored.\n";
+    }
+
+    const PowerConfig& power = options.engine.power;
+    if (power.enabled() && options.engine.mode == EngineMode::THREADED) {
+        std::cout << "Warning: --core-types, --dvfs, --governor, --dvfs-latency and "
+                  << "--energy-placement only apply to the event engine. They will be ignored.\n";
+    }
+
+    if (power.cores.size() > 1 && !options.sweep &&
+        power.cores.size() != static_cast<std::size_t>(options.num_cores)) {
+        std::cerr << "Error: --core-types lists " << power.cores.size() << " cores but --cores is "
+                  << options.num_cores << "\n";
+        return false;
+    }
+
+    if (power.frequencies.size() == 1 &&
+        (power.governor != Governor::PERFORMANCE || power.transition_latency > 0.0f)) {
+        std::cout << "Warning: --governor and --dvfs-latency have no effect with a single "
+                  << "--dvfs level. They will be ignored.\n";
+    }
+
+    if (options.engine.topology.sockets > options.num_cores && !options.sweep) {
+        std::cout << "Warning: --sockets is larger than --cores; some sockets have no cores.\n";
+    }
+
+    if (options.io_mix > 0.0f && !options.workload_file.empty()) {
+        std::cout << "Warning: --io-mix only applies to generated jobs; use a bursts column "
+                  << "in the workload file instead. It will be ignored.\n";
+    }
+
+    if (options.use_generator && !options.workload_file.empty()) {
+        std::cout << "Warning: workload model options only apply to generated jobs. "
+                  << "They will be ignored.\n";
+    }
+
+    if (options.generate_only && options.save_workload.empty()) {
+        std::cerr << "Error: --generate-only requires --save-workload\n";
+        return false;
+    }
+
+    if (options.sweep && options.compare_all) {
+        std::cerr << "Error: --sweep and --compare-all cannot be combined\n";
+        return false;
+    }
+
+    if (!options.trace_file.empty() && (options.compare_all || options.sweep)) {
+        std::cout << "Warning: --trace only applies to single-algorithm runs. "
+                  << "It will be ignored.\n";
+    }
+
+    if (options.engine.admission.action == AdmissionAction::DOWNGRADE &&
+        !options.engine.admission.enabled()) {
+        std::cout << "Warning: --admission-action has no effect without --admission. "
+                  << "It will be ignored.\n";
+    }
+
+    if (options.algorithm == SchedulingAlgorithm::EDF && options.workload_file.empty() &&
+        !(options.generator.deadline_slack > 0.0)) {
+        std::cout << "Warning: generated jobs have no deadlines without --deadline-slack, "
+                  << "so EDF runs them in arrival order.\n";
+    }
+
+    if (options.trace_mmap && options.trace_file.empty()) {
+        std::cout << "Warning: --trace-mmap has no effect without --trace.\n";
+    }
+
+    if (!options.compare_all && !options.sweep && options.quantum.has_value() &&
+        options.algorithm != SchedulingAlgorithm::RR && options.algorithm != SchedulingAlgorithm::MLFQ &&
+        options.algorithm != SchedulingAlgorithm::CFS) {
+        std::cout << "Warning: --quantum specified but algorithm is not time-sliced. "
                   << "Quantum will be ignored.\n";
     }
     
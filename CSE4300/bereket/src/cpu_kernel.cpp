@@ -0,0 +1,180 @@
+#include "cpu_kernel.h"
+#include "cycle_clock.h"
+
+#include <algorithm>
+#include <cctype>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace chronos {
+namespace {
+// Work per unit, sized so one unit is well under a microsecond on a current core
+constexpr int SPIN_STEPS = 256;
+constexpr std::size_t STREAM_DOUBLES = 512;     // 4 KB per unit
+constexpr int CHASE_LOADS = 64;
+
+// How many units run between checks of the cancel flag
+constexpr std::uint64_t CANCEL_STRIDE = 64;
+}
+
+CpuKernel::CpuKernel(ExecutionMode mode, std::size_t working_set)
+    : mode_(mode)
+{
+    if (mode_ == ExecutionMode::STREAM) {
+        const std::size_t doubles = std::max(STREAM_DOUBLES, working_set / sizeof(double));
+        stream_.assign(doubles - doubles % STREAM_DOUBLES, 1.0);
+    } else if (mode_ == ExecutionMode::POINTER_CHASE) {
+        // Sattolo's shuffle: a random permutation that is one single cycle,
+        // so the chase visits the whole working set in an unpredictable order
+        const std::size_t count = std::max<std::size_t>(2, working_set / sizeof(std::uint32_t));
+        chase_.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            chase_[i] = static_cast<std::uint32_t>(i);
+        }
+        std::uint64_t rng = 0x2545F4914F6CDD1Dull;
+        for (std::size_t i = count - 1; i > 0; --i) {
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            std::swap(chase_[i], chase_[rng % i]);
+        }
+    }
+}
+
+void CpuKernel::runUnit() {
+    switch (mode_) {
+        case ExecutionMode::SPIN: {
+            std::uint64_t x = spin_state_;
+            for (int i = 0; i < SPIN_STEPS; ++i) {
+                x ^= x >> 12;
+                x ^= x << 25;
+                x ^= x >> 27;
+                x *= 0x2545F4914F6CDD1Dull;
+            }
+            spin_state_ = x;
+            break;
+        }
+        case ExecutionMode::STREAM: {
+            double* block = stream_.data() + stream_pos_;
+            for (std::size_t i = 0; i < STREAM_DOUBLES; ++i) {
+                block[i] = block[i] * 0.999 + 1.0;
+            }
+            stream_pos_ += STREAM_DOUBLES;
+            if (stream_pos_ == stream_.size()) {
+                stream_pos_ = 0;
+            }
+            break;
+        }
+        case ExecutionMode::POINTER_CHASE: {
+            std::uint32_t pos = chase_pos_;
+            for (int i = 0; i < CHASE_LOADS; ++i) {
+                pos = chase_[pos];
+            }
+            chase_pos_ = pos;
+            break;
+        }
+        case ExecutionMode::SLEEP:
+            break;
+    }
+}
+
+std::uint64_t CpuKernel::run(std::uint64_t units, const std::atomic<bool>* cancel) {
+    std::uint64_t done = 0;
+    while (done < units) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) {
+            break;
+        }
+        const std::uint64_t batch = std::min(CANCEL_STRIDE, units - done);
+        for (std::uint64_t i = 0; i < batch; ++i) {
+            runUnit();
+        }
+        done += batch;
+    }
+    return done;
+}
+
+double CpuKernel::calibrate(double seconds) {
+    // One warm-up pass over the working set, then double the batch until it
+    // runs long enough to time accurately
+    run(std::max<std::uint64_t>(1, (stream_.size() / STREAM_DOUBLES) + (chase_.size() / CHASE_LOADS)));
+    std::uint64_t units = 1024;
+    while (true) {
+        const std::uint64_t start = CycleClock::now();
+        run(units);
+        const double elapsed = CycleClock::toSeconds(CycleClock::now() - start);
+        if (elapsed >= seconds || units >= (std::uint64_t{1} << 40)) {
+            return elapsed > 0.0 ? static_cast<double>(units) / elapsed : 0.0;
+        }
+        units *= 2;
+    }
+}
+
+std::string CpuKernel::modeToString(ExecutionMode mode) {
+    switch (mode) {
+        case ExecutionMode::SLEEP:         return "sleep";
+        case ExecutionMode::SPIN:          return "spin";
+        case ExecutionMode::STREAM:        return "stream";
+        case ExecutionMode::POINTER_CHASE: return "chase";
+        default:                           return "Unknown";
+    }
+}
+
+std::optional<ExecutionMode> CpuKernel::stringToMode(const std::string& str) {
+    std::string upper_str = str;
+    std::transform(upper_str.begin(), upper_str.end(), upper_str.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+
+    if (upper_str == "SLEEP") {
+        return ExecutionMode::SLEEP;
+    } else if (upper_str == "SPIN") {
+        return ExecutionMode::SPIN;
+    } else if (upper_str == "STREAM") {
+        return ExecutionMode::STREAM;
+    } else if (upper_str == "CHASE" || upper_str == "POINTER-CHASE") {
+        return ExecutionMode::POINTER_CHASE;
+    }
+    return std::nullopt;
+}
+
+bool CpuKernel::pinCurrentThread(int core_id) {
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || CPU_COUNT(&allowed) == 0) {
+        return false;
+    }
+
+    // The (core_id mod N)-th allowed CPU, so cores spread over what the
+    // process may use (taskset, cgroups) rather than CPU numbers 0..N-1
+    int target = core_id % CPU_COUNT(&allowed);
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &allowed) && target-- == 0) {
+            cpu_set_t pinned;
+            CPU_ZERO(&pinned);
+            CPU_SET(cpu, &pinned);
+            return pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned) == 0;
+        }
+    }
+    return false;
+#else
+    (void)core_id;
+    return false;
+#endif
+}
+
+int CpuKernel::availableCpus() {
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0 && CPU_COUNT(&allowed) > 0) {
+        return CPU_COUNT(&allowed);
+    }
+#endif
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+}
@@ -0,0 +1,138 @@
+#include "dispatch_log.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace chronos {
+namespace {
+constexpr char MAGIC[8] = {'C', 'H', 'R', 'D', 'L', 'O', 'G', '2'};
+
+// Same bytes, so -0.0 vs 0.0 or a differently rounded time counts as a change
+bool sameBits(const DispatchRecord& lhs, const DispatchRecord& rhs) {
+    return std::memcmp(&lhs, &rhs, sizeof(DispatchRecord)) == 0;
+}
+
+void printRecord(std::ostream& out, const char* label, const DispatchRecord* record) {
+    out << "  " << label;
+    if (!record) {
+        out << "(no dispatch)\n";
+        return;
+    }
+    out << "t=" << std::setprecision(17) << record->time << std::setprecision(9) << " job "
+        << record->job_id << " on core " << record->core << ", slice " << record->slice << ", remaining " << record->remaining
+        << "\n";
+}
+} // namespace
+
+void DispatchLog::record(const DispatchRecord& dispatch) {
+    if (replaying() && divergence_ == SIZE_MAX &&
+        (records_.size() >= expected_.size() || !sameBits(dispatch, expected_[records_.size()]))) {
+        divergence_ = records_.size();
+    }
+    records_.push_back(dispatch);
+}
+
+bool DispatchLog::save(const std::string& path, const std::string& algorithm, int num_cores,
+                       std::uint32_t seed) const {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Error: Could not open dispatch log for writing: " << path << "\n";
+        return false;
+    }
+
+    DispatchLogHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.record_size = sizeof(DispatchRecord);
+    header.num_cores = static_cast<std::uint32_t>(num_cores);
+    header.record_count = records_.size();
+    header.seed = seed;
+    std::strncpy(header.algorithm, algorithm.c_str(), sizeof(header.algorithm) - 1);
+
+    const bool written =
+        std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+        std::fwrite(records_.data(), sizeof(DispatchRecord), records_.size(), file) ==
+            records_.size();
+    if (std::fclose(file) != 0 || !written) {
+        std::cerr << "Error: Failed to write dispatch log: " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool DispatchLog::load(const std::string& path) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        std::cerr << "Error: Could not open dispatch log: " << path << "\n";
+        return false;
+    }
+
+    DispatchLogHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.record_size != sizeof(DispatchRecord)) {
+        std::cerr << "Error: Not a dispatch log: " << path << "\n";
+        std::fclose(file);
+        return false;
+    }
+
+    expected_.resize(static_cast<std::size_t>(header.record_count));
+    const std::size_t read = std::fread(expected_.data(), sizeof(DispatchRecord),
+                                        expected_.size(), file);
+    std::fclose(file);
+    if (read != expected_.size()) {
+        std::cerr << "Error: Dispatch log is truncated: " << path << " (" << read << " of "
+                  << expected_.size() << " records)\n";
+        expected_.clear();
+        return false;
+    }
+
+    header.algorithm[sizeof(header.algorithm) - 1] = '\0';
+    expected_algorithm_ = header.algorithm;
+    expected_cores_ = static_cast<int>(header.num_cores);
+    expected_seed_ = header.seed;
+    path_ = path;
+    restart();
+    return true;
+}
+
+void DispatchLog::restart() {
+    records_.clear();
+    divergence_ = SIZE_MAX;
+}
+
+bool DispatchLog::matches() const {
+    return divergence_ == SIZE_MAX && records_.size() == expected_.size();
+}
+
+void DispatchLog::printReplay(std::ostream& out, const std::string& algorithm,
+                              int num_cores) const {
+    if (!replaying()) {
+        return;
+    }
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+
+    if (algorithm != expected_algorithm_ || num_cores != expected_cores_) {
+        out << "Replay: " << path_ << " was recorded with " << expected_algorithm_ << " on "
+            << expected_cores_ << " core(s), seed " << expected_seed_ << "\n";
+    }
+    if (matches()) {
+        out << "Replay: all " << records_.size() << " dispatches match " << path_
+            << " bit for bit\n";
+    } else {
+        // A run that stopped short diverges where its dispatches run out
+        const std::size_t at = divergence_ == SIZE_MAX ? records_.size() : divergence_;
+        out << "Replay: diverged from " << path_ << " at dispatch " << at << " ("
+            << records_.size() << " dispatches vs " << expected_.size() << " recorded)\n";
+        printRecord(out, "recorded: ", at < expected_.size() ? &expected_[at] : nullptr);
+        printRecord(out, "this run: ", at < records_.size() ? &records_[at] : nullptr);
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+}
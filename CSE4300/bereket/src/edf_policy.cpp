@@ -0,0 +1,21 @@
+#include "edf_policy.h"
+#include "heap_ready_queue.h"
+#include <algorithm>
+
+namespace chronos {
+
+Job* EDFPolicy::getNextJob(std::vector<Job>& ready_queue) {
+    if (ready_queue.empty()) {
+        return nullptr;
+    }
+
+    auto it = std::min_element(ready_queue.begin(), ready_queue.end(), EDFOrder{});
+
+    return (it != ready_queue.end()) ? &(*it) : nullptr;
+}
+
+std::unique_ptr<ReadyQueue> EDFPolicy::createReadyQueue() {
+    return std::make_unique<HeapReadyQueue<EDFOrder>>();
+}
+
+}
@@ -0,0 +1,484 @@
+#include "event_simulator.h"
+#include "cfs_policy.h"
+#include "fcfs_policy.h"
+#include "mlfq_policy.h"
+#include "priority_policy.h"
+#include "rr_policy.h"
+#include "sjf_policy.h"
+#include "srtf_policy.h"
+#include "edf_policy.h"
+
+#include <algorithm>
+
+namespace chronos {
+namespace {
+constexpr double EPSILON = 1e-5;
+constexpr float MIN_SLICE = 0.001f;
+} // namespace
+
+template <typename Policy>
+BasicEventSimulator<Policy>::BasicEventSimulator(Policy& policy, int num_cores, TraceWriter* trace,
+                                                 const CostModel& cost, const Topology& topology,
+                                                 int io_depth)
+    : policy_(policy)
+    , num_cores_(num_cores)
+    , trace_(trace)
+    , cost_(cost)
+    , topology_(topology)
+    , cores_(static_cast<std::size_t>(num_cores))
+    , device_(io_depth)
+{
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::run(const std::vector<Job>& jobs, ScheduleResult& result) {
+    pending_ = &jobs;
+    next_arrival_ = 0;
+    // Policy::Queue is the type createReadyQueue() is declared to return
+    queue_owner_ = policy_.createReadyQueue();
+    ready_queue_ = static_cast<Queue*>(queue_owner_.get());
+    dispatches_ = 0;
+    preemptions_ = 0;
+    cost_totals_ = CostTotals();
+    device_ = IoDevice(device_.depth());
+    waiting_.clear();
+    free_waiting_.clear();
+
+    energy_ = EnergyStats();
+    energy_.enabled = power_.enabled();
+    if (power_.frequencies.empty()) {
+        power_.frequencies.push_back(1.0f);
+    }
+    for (Core& core : cores_) {
+        core.rate = 1.0f;
+        core.level = power_.frequencies.size() - 1;
+        core.busy_time = 0.0;
+    }
+
+    // Size the event heap and the I/O slots for their worst case up front
+    // (one event per core, the next arrival, one completion per blocked job)
+    // so the run loop never reallocates them
+    std::size_t io_jobs = 0;
+    for (const Job& job : jobs) {
+        io_jobs += job.hasIoBursts() ? 1 : 0;
+    }
+    std::vector<Event> storage;
+    storage.reserve(static_cast<std::size_t>(num_cores_) + 1 + io_jobs);
+    events_ = decltype(events_)(EventLater(), std::move(storage));
+    waiting_.reserve(io_jobs);
+    free_waiting_.reserve(io_jobs);
+
+    if (jobs.empty()) {
+        return;
+    }
+
+    // Only the next arrival is kept in the event queue, so the heap never
+    // holds more than num_cores + 1 events however many jobs are pending.
+    schedule(jobs.front().getArrivalTime(), EventType::ARRIVAL, -1);
+
+    while (!events_.empty()) {
+        const double now = events_.top().time;
+        last_event_ = now;
+
+        // Drain every event at this instant before making dispatch decisions
+        while (!events_.empty() && events_.top().time <= now + EPSILON) {
+            const Event event = events_.top();
+            events_.pop();
+            handleEvent(event, result);
+        }
+
+        dispatchIdleCores(now);
+        if (live_) {
+            live_->setQueueDepth(ready_queue_->size());
+        }
+
+        // Whole machine idle until the next arrival
+        const bool any_busy = std::any_of(cores_.begin(), cores_.end(),
+                                          [](const Core& core) { return core.busy; });
+        if (!any_busy && !events_.empty()) {
+            result.idle_time += static_cast<float>(events_.top().time - now);
+        }
+    }
+
+    result.context_switches = dispatches_;
+    result.preemptions = preemptions_;
+    result.migrations = cost_totals_.migrations;
+    result.remote_migrations = cost_totals_.remote_migrations;
+    result.switch_overhead_time = static_cast<float>(cost_totals_.switch_overhead);
+    result.warmup_time = static_cast<float>(cost_totals_.warmup);
+    result.io_depth = device_.depth();
+    result.io_requests = device_.requests();
+    result.io_wait_time = static_cast<float>(device_.waitTime());
+    result.io_queue_time = static_cast<float>(device_.queueTime());
+    result.device_busy_time = static_cast<float>(device_.busyTime());
+    if (power_.enabled()) {
+        finishEnergy(result);
+    }
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::finishEnergy(ScheduleResult& result) {
+    // Every core is on from the first arrival until the last event, drawing
+    // its idle power whenever it is not busy
+    energy_.duration = std::max(0.0, last_event_ - static_cast<double>(pending_->front().getArrivalTime()));
+    for (int core_id = 0; core_id < num_cores_; ++core_id) {
+        const double idle = std::max(0.0, energy_.duration - cores_[static_cast<std::size_t>(core_id)].busy_time);
+        energy_.idle_joules += idle * power_.coreType(core_id).idle_watts;
+    }
+    result.energy = energy_;
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::chargeSlice(Core& core, double now) {
+    const double busy = std::max(0.0, now - core.busy_since);
+    core.busy_time += busy;
+    energy_.busy_time += busy;
+    energy_.run_time += std::max(0.0, now - core.dispatched);
+    energy_.active_joules += busy * core.watts;
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::schedule(double time, EventType type, int core) {
+    events_.push(Event{time, type, core, next_seq_++});
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::handleEvent(const Event& event, ScheduleResult& result) {
+    if (event.type == EventType::ARRIVAL) {
+        admitArrivals(event.time);
+        return;
+    }
+    if (event.type == EventType::IO_COMPLETION) {
+        endIo(event.core, event.time);
+        return;
+    }
+
+    Core& core = cores_[static_cast<std::size_t>(event.core)];
+    if (!core.busy || event.seq != core.event_seq) {
+        return;     // End of a slice that was preempted
+    }
+    Job& job = core.job;
+    const double finish_time = event.time;
+    core.busy = false;
+    if (power_.enabled()) {
+        chargeSlice(core, event.time);
+    }
+    if (live_) {
+        live_->recordSlice(event.core, core.dispatched, core.slice);
+    }
+
+    if (event.type == EventType::COMPLETION && job.getPendingIoBurst() > 0.0f) {
+        job.setRemainingTime(0.0f);
+        job.setState(JobState::WAITING);
+        policy_.onJobCompletion(&job, finish_time);
+        beginIo(std::move(job), event.core, event.time);
+        return;
+    }
+
+    if (event.type == EventType::COMPLETION) {
+        job.setRemainingTime(0.0f);
+        job.setFinishTime(finish_time);
+        job.setState(JobState::FINISHED);
+        policy_.onJobCompletion(&job, finish_time);
+        if (trace_) {
+            trace_->record(TraceEventType::COMPLETION, event.time, job.getId(), event.core,
+                           job.getTurnaroundTime());
+        }
+        if (live_) {
+            live_->recordCompletion(event.core, job.getTurnaroundTime());
+        }
+        result.completed_jobs.append(job);
+        return;
+    }
+
+    // Slice expired with work left: hand the job back to the ready queue
+    job.setRemainingTime(core.remaining - core.work);
+    job.setState(JobState::READY);
+    policy_.onJobCompletion(&job, finish_time);
+    if (trace_) {
+        trace_->record(TraceEventType::SLICE_END, event.time, job.getId(), event.core,
+                       job.getRemainingTime());
+    }
+    ready_queue_->requeue(std::move(job));
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::admitArrivals(double now) {
+    const std::vector<Job>& pending = *pending_;
+    while (next_arrival_ < pending.size() &&
+           pending[next_arrival_].getArrivalTime() <= now + EPSILON) {
+        Job job = pending[next_arrival_++];
+        job.setState(JobState::READY);
+        if (admission_ &&
+            !admission_->admit(job, AdmissionView{ready_queue_->size(), num_cores_})) {
+            continue;   // Rejected: never queued or traced
+        }
+        if (trace_) {
+            trace_->record(TraceEventType::ARRIVAL, job.getArrivalTime(), job.getId(), -1,
+                           job.getBurstTime(), job.getPriority());
+        }
+        if (policy_.preemptsOnArrival()) {
+            preemptFor(job, now);
+        }
+        ready_queue_->push(std::move(job));
+    }
+
+    if (next_arrival_ < pending.size()) {
+        schedule(pending[next_arrival_].getArrivalTime(), EventType::ARRIVAL, -1);
+    }
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::beginIo(Job job, int core_id, double now) {
+    const IoDevice::Request request = device_.submit(now, job.getPendingIoBurst());
+    if (trace_) {
+        trace_->record(TraceEventType::IO_START, now, job.getId(), core_id,
+                       job.getPendingIoBurst(), request.channel);
+    }
+
+    int slot = static_cast<int>(waiting_.size());
+    if (free_waiting_.empty()) {
+        waiting_.push_back(Waiting{std::move(job), now});
+    } else {
+        slot = free_waiting_.back();
+        free_waiting_.pop_back();
+        waiting_[static_cast<std::size_t>(slot)] = Waiting{std::move(job), now};
+    }
+    schedule(request.finish, EventType::IO_COMPLETION, slot);
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::endIo(int slot, double now) {
+    Waiting& waiting = waiting_[static_cast<std::size_t>(slot)];
+    Job& job = waiting.job;
+    if (trace_) {
+        trace_->record(TraceEventType::IO_END, now, job.getId(), -1,
+                       static_cast<float>(now - waiting.since));
+    }
+    job.startNextCpuBurst();
+    job.setReadyTime(now);
+    job.setState(JobState::READY);
+    if (policy_.preemptsOnArrival()) {
+        preemptFor(job, now);
+    }
+    ready_queue_->push(std::move(job));
+    free_waiting_.push_back(slot);
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::dispatchIdleCores(double now) {
+    for (int core_id = 0; core_id < num_cores_ && !ready_queue_->empty();) {
+        Core& core = cores_[static_cast<std::size_t>(core_id)];
+        if (core.busy) {
+            ++core_id;
+            continue;
+        }
+
+        if (!ready_queue_->pop(core.job)) {
+            break;
+        }
+
+        const int target = chooseCore(core_id, now);
+        if (target != core_id) {
+            // Placed on a later idle core: this one is still free for the next job
+            cores_[static_cast<std::size_t>(target)].job = std::move(core.job);
+            startSlice(target, now);
+            continue;
+        }
+        startSlice(core_id, now);
+        ++core_id;
+    }
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::startSlice(int core_id, double now) {
+    Core& core = cores_[static_cast<std::size_t>(core_id)];
+    Job& job = core.job;
+    ++dispatches_;
+
+    // The core switches (and warms its cache) before the job runs
+    double run_start =
+        now + cost_totals_.charge(cost_, job, core_id, topology_.nodeOf(core_id, num_cores_));
+
+    if (power_.enabled()) {
+        // Changing frequency stalls the core first
+        const std::size_t level = nextLevel();
+        if (level != core.level) {
+            core.level = level;
+            run_start += power_.transition_latency;
+            ++energy_.transitions;
+            energy_.transition_time += power_.transition_latency;
+        }
+        const CoreType& type = power_.coreType(core_id);
+        const float frequency = power_.frequencies[level];
+        core.rate = type.speed * frequency;
+        core.watts = PowerConfig::activePower(type, frequency);
+        core.busy_since = now;
+    }
+
+    const bool first_dispatch = job.getStartTime() < 0.0f;
+    if (first_dispatch) {
+        job.setStartTime(run_start);
+    }
+    job.setState(JobState::RUNNING);
+
+    // Same slice rule as WorkerPool: run to completion unless the policy
+    // hands out a quantum shorter than the remaining work. The quantum is
+    // wall time, so a slower core gets less of the job done in it.
+    const float time_slice = policy_.getTimeSlice(job);
+    const float remaining = job.getRemainingTime();
+    float work = remaining;
+    if (time_slice > 0.0f) {
+        work = std::min(remaining, time_slice * core.rate);
+    }
+    if (work < MIN_SLICE) {
+        work = remaining;
+    }
+    const float execution = work / core.rate;
+    job.setLastSlice(execution);
+    core.slice = execution;
+    core.work = work;
+    core.dispatched = run_start;
+    core.remaining = remaining;
+    core.busy = true;
+    if (trace_) {
+        trace_->record(TraceEventType::DISPATCH, run_start, job.getId(), core_id,
+                       execution, first_dispatch ? 1 : 0);
+    }
+
+    const bool finishes = remaining - work < MIN_SLICE;
+    core.event_seq = next_seq_;
+    schedule(run_start + execution, finishes ? EventType::COMPLETION : EventType::SLICE_END, core_id);
+}
+
+template <typename Policy>
+std::size_t BasicEventSimulator<Policy>::nextLevel() const {
+    int running = 1;
+    if (power_.governor == Governor::ONDEMAND) {
+        for (const Core& core : cores_) {
+            running += core.busy ? 1 : 0;
+        }
+    }
+    return power_.pickLevel(running, ready_queue_->size(), num_cores_);
+}
+
+template <typename Policy>
+int BasicEventSimulator<Policy>::chooseCore(int first_idle, double now) const {
+    if (!power_.enabled() || power_.placement == EnergyPlacement::IN_ORDER) {
+        return first_idle;
+    }
+
+    const Job& job = cores_[static_cast<std::size_t>(first_idle)].job;
+    const float frequency = power_.frequencies[nextLevel()];
+    int fastest = -1;
+    int efficient = -1;
+    int efficient_fit = -1;     // ... of the cores that meet the job's deadline
+    float best_speed = 0.0f;
+    float best_cost = 0.0f;
+    float best_fit_cost = 0.0f;
+    for (int core_id = first_idle; core_id < num_cores_; ++core_id) {
+        if (core_id != first_idle && cores_[static_cast<std::size_t>(core_id)].busy) {
+            continue;
+        }
+        const CoreType& type = power_.coreType(core_id);
+        const float rate = type.speed * frequency;
+        const float cost = type.joulesPerWork(frequency);
+        if (fastest < 0 || type.speed > best_speed) {
+            fastest = core_id;
+            best_speed = type.speed;
+        }
+        if (efficient < 0 || cost < best_cost) {
+            efficient = core_id;
+            best_cost = cost;
+        }
+        const bool fits = !job.hasDeadline() ||
+                          now + static_cast<double>(job.getRemainingTime() / rate) <= job.getDeadline();
+        if (fits && (efficient_fit < 0 || cost < best_fit_cost)) {
+            efficient_fit = core_id;
+            best_fit_cost = cost;
+        }
+    }
+
+    switch (power_.placement) {
+        case EnergyPlacement::FASTEST:
+            return fastest;
+        case EnergyPlacement::EFFICIENT:
+            return efficient;
+        case EnergyPlacement::ENERGY_AWARE:
+            return efficient_fit >= 0 ? efficient_fit : fastest;
+        default:
+            return first_idle;
+    }
+}
+
+template <typename Policy>
+void BasicEventSimulator<Policy>::preemptFor(const Job& arriving, double now) {
+    // An idle core will pick everything already queued plus this arrival
+    std::size_t idle = 0;
+    for (const Core& core : cores_) {
+        idle += core.busy ? 0 : 1;
+    }
+    if (idle > ready_queue_->size()) {
+        return;
+    }
+
+    int victim = -1;
+    for (int core_id = 0; core_id < num_cores_; ++core_id) {
+        Core& core = cores_[static_cast<std::size_t>(core_id)];
+        const double elapsed = std::max(0.0, now - core.dispatched);
+        if (!core.busy || elapsed >= core.slice - MIN_SLICE) {
+            continue;   // Idle, or the slice ends at this instant anyway
+        }
+
+        // Show the policy the work left right now
+        core.job.setRemainingTime(core.remaining - static_cast<float>(elapsed) * core.rate);
+        if (!policy_.shouldPreempt(core.job, arriving)) {
+            continue;
+        }
+        // Among candidates, displace the one every other candidate beats
+        if (victim < 0 ||
+            policy_.shouldPreempt(core.job, cores_[static_cast<std::size_t>(victim)].job)) {
+            victim = core_id;
+        }
+    }
+    if (victim < 0) {
+        return;
+    }
+
+    Core& core = cores_[static_cast<std::size_t>(victim)];
+    Job& job = core.job;
+    // Preempted during the switch itself: no progress
+    const float executed = static_cast<float>(std::max(0.0, now - core.dispatched));
+    job.setRemainingTime(core.remaining - executed * core.rate);
+    job.setLastSlice(executed);
+    job.setState(JobState::READY);
+    core.busy = false;
+    ++preemptions_;
+    if (power_.enabled()) {
+        chargeSlice(core, now);
+    }
+    if (live_) {
+        live_->recordSlice(victim, core.dispatched, executed);
+    }
+
+    policy_.onJobCompletion(&job, now);
+    if (trace_) {
+        trace_->record(TraceEventType::SLICE_END, now, job.getId(), victim,
+                       job.getRemainingTime(), 1);
+    }
+    ready_queue_->requeue(std::move(job));
+}
+
+// The generic simulator, and one per built-in policy (SchedulerEngine)
+template class BasicEventSimulator<ISchedulingPolicy>;
+template class BasicEventSimulator<FCFSPolicy>;
+template class BasicEventSimulator<SJFPolicy>;
+template class BasicEventSimulator<PriorityPolicy>;
+template class BasicEventSimulator<PreemptivePriorityPolicy>;
+template class BasicEventSimulator<RoundRobinPolicy>;
+template class BasicEventSimulator<MLFQPolicy>;
+template class BasicEventSimulator<CFSPolicy>;
+template class BasicEventSimulator<SRTFPolicy>;
+template class BasicEventSimulator<EDFPolicy>;
+
+}
@@ -0,0 +1,179 @@
+#include "fair_share_policy.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace chronos {
+
+FairSharePolicy::FairSharePolicy(const Factory& make_inner, int tenants, std::vector<double> weights)
+    : weights_(std::move(weights))
+{
+    if (!make_inner) {
+        throw std::invalid_argument("FairSharePolicy requires an inner policy.");
+    }
+    for (double weight : weights_) {
+        if (!(weight > 0.0)) {
+            throw std::invalid_argument("FairSharePolicy requires positive tenant weights.");
+        }
+    }
+
+    const int count = std::max({1, tenants, static_cast<int>(weights_.size())});
+    inner_.reserve(static_cast<std::size_t>(count));
+    for (int tenant = 0; tenant < count; ++tenant) {
+        inner_.push_back(make_inner());
+        if (!inner_.back()) {
+            throw std::invalid_argument("FairSharePolicy requires an inner policy.");
+        }
+    }
+}
+
+double FairSharePolicy::weightOf(int tenant) const {
+    return tenant >= 0 && static_cast<std::size_t>(tenant) < weights_.size()
+               ? weights_[static_cast<std::size_t>(tenant)] : 1.0;
+}
+
+ISchedulingPolicy& FairSharePolicy::inner(int tenant) const {
+    const std::size_t index = std::min(static_cast<std::size_t>(std::max(0, tenant)),
+                                       inner_.size() - 1);
+    return *inner_[index];
+}
+
+Job* FairSharePolicy::getNextJob(std::vector<Job>& ready_queue) {
+    return inner_.front()->getNextJob(ready_queue);
+}
+
+void FairSharePolicy::onJobCompletion(Job* completed_job, double current_time) {
+    if (!completed_job) {
+        return;
+    }
+
+    const int tenant = std::min(completed_job->getTenant(), getTenants() - 1);
+    {
+        std::lock_guard<std::mutex> lock(charge_mutex_);
+        if (const Charge* charge = charges_.find(completed_job->getId())) {
+            const double service = completed_job->getLastSlice() / weightOf(tenant);
+            refunds_[charge->queue][static_cast<std::size_t>(tenant)] += charge->vtime - service;
+            charges_.erase(completed_job->getId());
+        }
+    }
+    inner(tenant).onJobCompletion(completed_job, current_time);
+}
+
+bool FairSharePolicy::shouldPreempt(const Job& running, const Job& arriving) const {
+    return running.getTenant() == arriving.getTenant() &&
+           inner(arriving.getTenant()).shouldPreempt(running, arriving);
+}
+
+std::unique_ptr<ReadyQueue> FairSharePolicy::createReadyQueue() {
+    return std::make_unique<FairShareReadyQueue>(*this);
+}
+
+FairShareReadyQueue::FairShareReadyQueue(FairSharePolicy& policy)
+    : policy_(policy)
+    , tenants_(static_cast<std::size_t>(policy.getTenants()))
+{
+    std::lock_guard<std::mutex> lock(policy_.charge_mutex_);
+    index_ = policy_.refunds_.size();
+    policy_.refunds_.emplace_back(tenants_.size(), 0.0);
+}
+
+FairShareReadyQueue::Tenant& FairShareReadyQueue::admit(const Job& job) {
+    const int id = std::min(job.getTenant(), policy_.getTenants() - 1);
+    Tenant& tenant = tenants_[static_cast<std::size_t>(id)];
+    if (!tenant.queue) {
+        tenant.queue = policy_.inner(id).createReadyQueue();
+    }
+    if (tenant.queue->empty()) {
+        {
+            std::lock_guard<std::mutex> lock(policy_.charge_mutex_);
+            settle(id);
+        }
+        tenant.vtime = std::max(tenant.vtime, clock_);
+        active_.push_back(id);
+    }
+    return tenant;
+}
+
+void FairShareReadyQueue::deactivate(std::size_t active_index) {
+    active_[active_index] = active_.back();
+    active_.pop_back();
+}
+
+void FairShareReadyQueue::settle(int tenant) {
+    double& refund = policy_.refunds_[index_][static_cast<std::size_t>(tenant)];
+    tenants_[static_cast<std::size_t>(tenant)].vtime -= refund;
+    refund = 0.0;
+}
+
+void FairShareReadyQueue::push(Job job) {
+    admit(job).queue->push(std::move(job));
+    ++size_;
+}
+
+void FairShareReadyQueue::requeue(Job job) {
+    admit(job).queue->requeue(std::move(job));
+    ++size_;
+}
+
+bool FairShareReadyQueue::pop(Job& out) {
+    if (active_.empty()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(policy_.charge_mutex_);
+    for (int id : active_) {
+        settle(id);
+    }
+
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < active_.size(); ++i) {
+        const Tenant& candidate = tenants_[static_cast<std::size_t>(active_[i])];
+        const Tenant& current = tenants_[static_cast<std::size_t>(active_[best])];
+        if (candidate.vtime < current.vtime ||
+            (candidate.vtime == current.vtime && active_[i] < active_[best])) {
+            best = i;
+        }
+    }
+
+    const int id = active_[best];
+    Tenant& tenant = tenants_[static_cast<std::size_t>(id)];
+    if (!tenant.queue->pop(out)) {
+        return false;
+    }
+    --size_;
+    if (tenant.queue->empty()) {
+        deactivate(best);
+    }
+
+    // Charge the slice the engine plans to run: the policy's quantum, or the
+    // rest of the burst, whichever is shorter. onJobCompletion settles it.
+    clock_ = std::max(clock_, tenant.vtime);
+    const float slice = policy_.inner(id).getTimeSlice(out);
+    const float run = slice > 0.0f ? std::min(slice, out.getRemainingTime()) : out.getRemainingTime();
+    const double charge = static_cast<double>(run) / policy_.weightOf(id);
+    tenant.vtime += charge;
+    policy_.charges_.set(out.getId(), FairSharePolicy::Charge{index_, charge});
+    return true;
+}
+
+bool FairShareReadyQueue::remove(int job_id, Job& out) {
+    for (std::size_t i = 0; i < active_.size(); ++i) {
+        Tenant& tenant = tenants_[static_cast<std::size_t>(active_[i])];
+        if (tenant.queue->remove(job_id, out)) {
+            --size_;
+            if (tenant.queue->empty()) {
+                deactivate(i);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FairShareReadyQueue::contains(int job_id) const {
+    return std::any_of(active_.begin(), active_.end(), [this, job_id](int id) {
+        return tenants_[static_cast<std::size_t>(id)].queue->contains(job_id);
+    });
+}
+
+}
@@ -1,4 +1,5 @@
 #include "fcfs_policy.h"
+#include "heap_ready_queue.h"
 #include <algorithm>
 
 namespace chronos {
@@ -8,19 +9,14 @@ Job* FCFSPolicy::getNextJob(std::vector<Job>& ready_queue) {
         return nullptr;
     }
 
-    // Select by earliest arrival and tie-break on job_id.
-    auto it = std::min_element(
-        ready_queue.begin(),
-        ready_queue.end(),
-        [](const Job& a, const Job& b) {
-            if (a.getArrivalTime() != b.getArrivalTime()) {
-                return a.getArrivalTime() < b.getArrivalTime();
-            }
-            return a.getId() < b.getId();
-        }
-    );
+    // Select by earliest ready time and tie-break on job_id.
+    auto it = std::min_element(ready_queue.begin(), ready_queue.end(), FCFSOrder{});
 
     return (it != ready_queue.end()) ? &(*it) : nullptr;
 }
 
+std::unique_ptr<ReadyQueue> FCFSPolicy::createReadyQueue() {
+    return std::make_unique<HeapReadyQueue<FCFSOrder>>();
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "fifo_ready_queue.h"
+
+#include <utility>
+
+namespace chronos {
+
+void FifoReadyQueue::push(Job job) {
+    const std::uint32_t node = allocateNode();
+    index_.set(job.getId(), node);
+
+    Node& entry = nodes_[node];
+    entry.job = std::move(job);
+    entry.prev = tail_;
+    entry.next = NIL;
+
+    if (tail_ != NIL) {
+        nodes_[tail_].next = node;
+    } else {
+        head_ = node;
+    }
+    tail_ = node;
+    ++size_;
+}
+
+bool FifoReadyQueue::pop(Job& out) {
+    if (head_ == NIL) {
+        return false;
+    }
+
+    const std::uint32_t node = head_;
+    out = std::move(nodes_[node].job);
+    index_.erase(out.getId());
+    unlink(node);
+    return true;
+}
+
+bool FifoReadyQueue::remove(int job_id, Job& out) {
+    const std::uint32_t* found = index_.find(job_id);
+    if (!found) {
+        return false;
+    }
+
+    const std::uint32_t node = *found;
+    index_.erase(job_id);
+    out = std::move(nodes_[node].job);
+    unlink(node);
+    return true;
+}
+
+bool FifoReadyQueue::contains(int job_id) const {
+    return index_.contains(job_id);
+}
+
+std::uint32_t FifoReadyQueue::allocateNode() {
+    if (!free_nodes_.empty()) {
+        const std::uint32_t node = free_nodes_.back();
+        free_nodes_.pop_back();
+        return node;
+    }
+    nodes_.emplace_back();
+    return static_cast<std::uint32_t>(nodes_.size() - 1);
+}
+
+void FifoReadyQueue::unlink(std::uint32_t node) {
+    Node& entry = nodes_[node];
+    if (entry.prev != NIL) {
+        nodes_[entry.prev].next = entry.next;
+    } else {
+        head_ = entry.next;
+    }
+    if (entry.next != NIL) {
+        nodes_[entry.next].prev = entry.prev;
+    } else {
+        tail_ = entry.prev;
+    }
+
+    entry.prev = NIL;
+    entry.next = NIL;
+    free_nodes_.push_back(node);
+    --size_;
+}
+
+}
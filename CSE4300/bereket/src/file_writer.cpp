@@ -1,5 +1,6 @@
 #include "file_writer.h"
 
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -25,26 +26,45 @@ bool FileWriter::writeMetricsCSV(const MetricsCollector& metrics,
         return false;
     }
     
+    // A tenant column only when there is more than one, so single-tenant
+    // files keep their layout (the workload loader reads it either way)
+    const bool tenants = metrics.getTenantCount() > 1;
+    // Likewise deadline and slo columns only when some job has them
+    // (a job without a deadline leaves the cell empty)
+    const bool slo = metrics.getCompletedJobs().hasSloInfo();
+
     // Write CSV header
     file << "algorithm,job_id,arrival_time,burst_time,priority,"
+         << (tenants ? "tenant," : "")
+         << (slo ? "deadline,slo," : "")
          << "start_time,finish_time,waiting_time,turnaround_time,remaining_time\n";
     
 
     const auto& jobs = metrics.getCompletedJobs();
     const std::string algo_name = policy.getName();
+    file << std::fixed << std::setprecision(2);   // Sticky, set once for every row
     
-    for (const auto& job : jobs) {
+    // Only finished jobs are recorded, so remaining_time is always zero
+    for (std::size_t row = 0; row < jobs.size(); ++row) {
         file << algo_name << ","
-             << job.getId() << ","
-             << std::fixed << std::setprecision(2)
-             << job.getArrivalTime() << ","
-             << job.getBurstTime() << ","
-             << job.getPriority() << ","
-             << job.getStartTime() << ","
-             << job.getFinishTime() << ","
-             << job.getWaitingTime() << ","
-             << job.getTurnaroundTime() << ","
-             << job.getRemainingTime() << "\n";
+             << jobs.id(row) << ","
+             << jobs.arrivalTime(row) << ","
+             << jobs.burstTime(row) << ","
+             << jobs.priority(row) << ",";
+        if (tenants) {
+            file << jobs.tenant(row) << ",";
+        }
+        if (slo) {
+            if (std::isfinite(jobs.deadline(row))) {
+                file << jobs.deadline(row);
+            }
+            file << "," << sloClassToString(jobs.sloClass(row)) << ",";
+        }
+        file << jobs.startTime(row) << ","
+             << jobs.finishTime(row) << ","
+             << jobs.waitingTime(row) << ","
+             << jobs.turnaroundTime(row) << ","
+             << 0.0f << "\n";
     }
     
     file.close();
@@ -59,22 +79,14 @@ bool FileWriter::writeMetricsCSV(const MetricsCollector& metrics,
 bool FileWriter::writeSummaryCSV(const MetricsCollector& metrics,
                                  const ISchedulingPolicy& policy,
                                  const std::string& filename) {
-    std::ofstream file(filename, std::ios::app); // Append mode for compare-all
-    if (!file.is_open()) {
-        std::cerr << "Error: Could not open file for writing: " << filename << "\n";
+    const std::string header = std::string("algorithm,avg_waiting_time,avg_turnaround_time,")
+                               + "cpu_utilization,context_switches,num_jobs,makespan"
+                               + latencyColumnsHeader();
+    std::ofstream file;
+    if (!openForAppend(file, filename, header)) {
         return false;
     }
     
-    // Check if file is empty (first write) and write header
-    file.seekp(0, std::ios::end);
-    bool is_empty = file.tellp() == 0;
-    file.seekp(0, std::ios::beg);
-    
-    if (is_empty) {
-        file << "algorithm,avg_waiting_time,avg_turnaround_time,"
-             << "cpu_utilization,context_switches,num_jobs,makespan\n";
-    }
-    
     // Write aggregate metrics
     file << policy.getName() << ","
          << std::fixed << std::setprecision(2)
@@ -83,7 +95,9 @@ bool FileWriter::writeSummaryCSV(const MetricsCollector& metrics,
          << metrics.getCpuUtilizationPercent() << ","
          << metrics.getContextSwitches() << ","
          << metrics.getJobCount() << ","
-         << metrics.getMakespan() << "\n";
+         << metrics.getMakespan();
+    writeLatencyColumns(file, metrics.getLatencyStats());
+    file << "\n";
     
     file.close();
     if (file.fail()) {
@@ -94,6 +108,88 @@ bool FileWriter::writeSummaryCSV(const MetricsCollector& metrics,
     return true;
 }
 
+bool FileWriter::writeTenantsCSV(const MetricsCollector& metrics,
+                                 const ISchedulingPolicy& policy,
+                                 const std::string& filename) {
+    std::ofstream file;
+    if (!openForAppend(file, filename,
+                       "algorithm,tenant,num_jobs,throughput,cpu_time,avg_waiting_time,"
+                       "avg_turnaround_time,ready_p50,ready_p99,turnaround_p50,turnaround_p99")) {
+        return false;
+    }
+
+    const std::string algo_name = policy.getName();
+    file << std::fixed << std::setprecision(2);
+    for (const TenantMetrics& tenant : metrics.getTenantMetrics()) {
+        file << algo_name << ","
+             << tenant.tenant << ","
+             << tenant.jobs << ","
+             << tenant.throughput << ","
+             << tenant.cpu_time << ","
+             << tenant.averageWaitingTime() << ","
+             << tenant.averageTurnaroundTime() << ","
+             << tenant.latency.ready.percentile(50.0) << ","
+             << tenant.latency.ready.percentile(99.0) << ","
+             << tenant.latency.turnaround.percentile(50.0) << ","
+             << tenant.latency.turnaround.percentile(99.0) << "\n";
+    }
+
+    file.close();
+    if (file.fail()) {
+        std::cerr << "Error: Failed to write to file: " << filename << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool FileWriter::writeEnergyCSV(const MetricsCollector& metrics,
+                                const ISchedulingPolicy& policy,
+                                const std::string& filename) {
+    std::ofstream file;
+    if (!openForAppend(file, filename,
+                       "algorithm,joules,active_joules,idle_joules,duration,avg_power,perf_per_watt,"
+                       "cpu_utilization,run_time,dvfs_transitions,dvfs_stall_time")) {
+        return false;
+    }
+
+    const EnergyStats& energy = metrics.getEnergy();
+    file << std::fixed << std::setprecision(4)
+         << policy.getName() << ","
+         << energy.joules() << ","
+         << energy.active_joules << ","
+         << energy.idle_joules << ","
+         << energy.duration << ","
+         << energy.averagePower() << ","
+         << metrics.getPerfPerWatt() << ","
+         << metrics.getCpuUtilizationPercent() << ","
+         << energy.run_time << ","
+         << energy.transitions << ","
+         << energy.transition_time << "\n";
+
+    file.close();
+    if (file.fail()) {
+        std::cerr << "Error: Failed to write to file: " << filename << "\n";
+        return false;
+    }
+    return true;
+}
+
+const char* FileWriter::latencyColumnsHeader() {
+    return ",ready_p50,ready_p99,ready_p999"
+           ",turnaround_p50,turnaround_p99,turnaround_p999"
+           ",response_p50,response_p99,response_p999"
+           ",slowdown_p50,slowdown_p99,slowdown_p999";
+}
+
+void FileWriter::writeLatencyColumns(std::ostream& os, const LatencyStats& latency) {
+    for (const LatencyHistogram* histogram : {&latency.ready, &latency.turnaround,
+                                              &latency.response, &latency.slowdown}) {
+        os << "," << histogram->percentile(50.0)
+           << "," << histogram->percentile(99.0)
+           << "," << histogram->percentile(99.9);
+    }
+}
+
 bool FileWriter::writeAll(const MetricsCollector& metrics,
                          const ISchedulingPolicy& policy,
                          const std::string& output_dir) {
@@ -105,17 +201,29 @@ bool FileWriter::writeAll(const MetricsCollector& metrics,
     
     const std::string metrics_file = output_dir + "/metrics.csv";
     const std::string summary_file = output_dir + "/summary.csv";
+    const std::string tenants_file = output_dir + "/tenants.csv";
+    const std::string energy_file = output_dir + "/energy.csv";
     
     // For metrics.csv, we want to overwrite (single algorithm run)
-    // For summary.csv, we append (to support compare-all mode)
+    // For summary.csv, tenants.csv and energy.csv, we append (to support compare-all mode)
     
     bool metrics_ok = writeMetricsCSV(metrics, policy, metrics_file);
     bool summary_ok = writeSummaryCSV(metrics, policy, summary_file);
+    const bool tenants = metrics.getTenantCount() > 1;
+    bool tenants_ok = !tenants || writeTenantsCSV(metrics, policy, tenants_file);
+    const bool energy = metrics.getEnergy().enabled;
+    bool energy_ok = !energy || writeEnergyCSV(metrics, policy, energy_file);
     
-    if (metrics_ok && summary_ok) {
+    if (metrics_ok && summary_ok && tenants_ok && energy_ok) {
         std::cout << "Metrics exported to:\n"
                   << "  - " << metrics_file << "\n"
                   << "  - " << summary_file << "\n";
+        if (tenants) {
+            std::cout << "  - " << tenants_file << "\n";
+        }
+        if (energy) {
+            std::cout << "  - " << energy_file << "\n";
+        }
         return true;
     }
     
@@ -134,4 +242,28 @@ bool FileWriter::ensureDirectoryExists(const std::string& dir_path) {
     return false;
 }
 
+bool FileWriter::openForAppend(std::ofstream& file, const std::string& filename,
+                               const std::string& header) {
+    std::string existing;
+    {
+        std::ifstream in(filename);
+        std::getline(in, existing);
+    }
+
+    // Rows appended under another build's header would not line up with it
+    const bool matches = existing == header;
+    if (!existing.empty() && !matches) {
+        std::cerr << "Warning: " << filename << " has different columns; starting it over\n";
+    }
+    file.open(filename, matches ? std::ios::app : std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open file for writing: " << filename << "\n";
+        return false;
+    }
+    if (!matches) {
+        file << header << "\n";
+    }
+    return true;
+}
+
 } // namespace chronos
\ No newline at end of file
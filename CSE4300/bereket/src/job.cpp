@@ -1,37 +1,63 @@
 #include "job.h"
+#include <cctype>
 #include <iomanip>
 #include <sstream>
 
 namespace chronos {
 
-Job::Job(int id, float arrival_time, float burst_time, int priority)
+Job::Job(int id, double arrival_time, float burst_time, int priority, int tenant)
     : job_id(id)
-    , arrival_time(arrival_time)
     , burst_time(burst_time)
     , remaining_time(burst_time)
-    , priority(priority)
+    , priority(static_cast<std::int16_t>(priority))
+    , tenant(static_cast<std::uint16_t>(tenant))
+    , arrival_time(arrival_time)
+    , start_time(-1.0)
+    , finish_time(-1.0)
+    , ready_time(arrival_time)
+    , deadline(NO_DEADLINE)
+    , last_slice(0.0f)
+    , vruntime(0.0f)
     , state(JobState::NEW)
-    , start_time(-1.0f)
-    , finish_time(-1.0f)
-    , waiting_time(0.0f)
-    , turnaround_time(0.0f)
+    , queue_level(0)
+    , last_core(-1)
+    , last_node(-1)
+    , slo_class(SloClass::STANDARD)
 {
 }
 
-void Job::calculateMetrics() {
-    if (start_time >= 0.0f && arrival_time >= 0.0f) {
-        waiting_time = start_time - arrival_time;
-        if (waiting_time < 0.0f) {
-            waiting_time = 0.0f;  // Job can't wait negative time
+void Job::setBursts(const std::vector<float>& bursts) {
+    burst_index = 0;
+    if (bursts.size() < 2) {
+        bursts_.reset();
+        if (!bursts.empty()) {
+            burst_time = remaining_time = bursts.front();
         }
+        return;
     }
-    
-    if (finish_time >= 0.0f && arrival_time >= 0.0f) {
-        turnaround_time = finish_time - arrival_time;
-        if (turnaround_time < 0.0f) {
-            turnaround_time = 0.0f;
-        }
+
+    float cpu_total = 0.0f;
+    for (std::size_t i = 0; i < bursts.size(); i += 2) {
+        cpu_total += bursts[i];
     }
+    bursts_ = std::make_shared<const std::vector<float>>(bursts);
+    burst_time = cpu_total;
+    remaining_time = bursts.front();
+}
+
+float Job::getPendingIoBurst() const {
+    if (!bursts_ || burst_index + 2u >= bursts_->size()) {
+        return 0.0f;
+    }
+    return (*bursts_)[burst_index + 1u];
+}
+
+void Job::startNextCpuBurst() {
+    if (!bursts_ || burst_index + 2u >= bursts_->size()) {
+        return;
+    }
+    burst_index = static_cast<std::uint16_t>(burst_index + 2u);
+    remaining_time = (*bursts_)[burst_index];
 }
 
 void Job::print(std::ostream& os) const {
@@ -41,18 +67,21 @@ void Job::print(std::ostream& os) const {
     os << "  Remaining Time: " << remaining_time << "\n";
     os << "  Priority: " << priority << "\n";
     os << "  State: " << stateToString(state) << "\n";
+    if (hasDeadline()) {
+        os << "  Deadline: " << deadline << " (" << sloClassToString(slo_class) << ")\n";
+    }
     
-    if (start_time >= 0.0f) {
+    if (start_time >= 0.0) {
         os << "  Start Time: " << start_time << "\n";
     }
-    if (finish_time >= 0.0f) {
+    if (finish_time >= 0.0) {
         os << "  Finish Time: " << finish_time << "\n";
     }
-    if (waiting_time >= 0.0f) {
-        os << "  Waiting Time: " << waiting_time << "\n";
+    if (start_time >= 0.0) {
+        os << "  Waiting Time: " << getWaitingTime() << "\n";
     }
-    if (turnaround_time >= 0.0f) {
-        os << "  Turnaround Time: " << turnaround_time << "\n";
+    if (finish_time >= 0.0) {
+        os << "  Turnaround Time: " << getTurnaroundTime() << "\n";
     }
 }
 
@@ -63,7 +92,7 @@ void Job::printTableRow(std::ostream& os) const {
        << std::setw(5) << burst_time << " | "
        << std::setw(5);
     
-    if (start_time >= 0.0f) {
+    if (start_time >= 0.0) {
         os << start_time;
     } else {
         os << "N/A";
@@ -71,7 +100,7 @@ void Job::printTableRow(std::ostream& os) const {
     
     os << " | " << std::setw(6);
     
-    if (finish_time >= 0.0f) {
+    if (finish_time >= 0.0) {
         os << finish_time;
     } else {
         os << "N/A";
@@ -79,16 +108,16 @@ void Job::printTableRow(std::ostream& os) const {
     
     os << " | " << std::setw(4);
     
-    if (waiting_time >= 0.0f) {
-        os << std::setprecision(1) << waiting_time;
+    if (start_time >= 0.0) {
+        os << std::setprecision(1) << getWaitingTime();
     } else {
         os << "N/A";
     }
     
     os << " | " << std::setw(10);
     
-    if (turnaround_time >= 0.0f) {
-        os << turnaround_time;
+    if (finish_time >= 0.0) {
+        os << getTurnaroundTime();
     } else {
         os << "N/A";
     }
@@ -113,6 +142,31 @@ bool Job::operator==(const Job& other) const {
     return job_id == other.job_id;
 }
 
+std::string sloClassToString(SloClass slo) {
+    switch (slo) {
+        case SloClass::CRITICAL:    return "critical";
+        case SloClass::STANDARD:    return "standard";
+        case SloClass::BEST_EFFORT: return "best-effort";
+        default:                    return "unknown";
+    }
+}
+
+std::optional<SloClass> stringToSloClass(const std::string& str) {
+    std::string lower = str;
+    for (char& c : lower) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    if (lower == "critical" || lower == "0") {
+        return SloClass::CRITICAL;
+    } else if (lower == "standard" || lower == "1") {
+        return SloClass::STANDARD;
+    } else if (lower == "best-effort" || lower == "besteffort" || lower == "best_effort" ||
+               lower == "2") {
+        return SloClass::BEST_EFFORT;
+    }
+    return std::nullopt;
+}
+
 std::string stateToString(JobState state) {
     switch (state) {
         case JobState::NEW:      return "NEW";
@@ -0,0 +1,178 @@
+#include "job_table.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace chronos {
+namespace {
+// Independent accumulators break the serial add chain so the loops vectorise
+// without -ffast-math; partial sums are double to keep 10M-row totals exact
+// to well below the printed precision.
+constexpr std::size_t LANES = 8;
+
+double sumColumn(const float* values, std::size_t count) {
+    double lanes[LANES] = {};
+    std::size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (std::size_t lane = 0; lane < LANES; ++lane) {
+            lanes[lane] += values[i + lane];
+        }
+    }
+    for (; i < count; ++i) {
+        lanes[0] += values[i];
+    }
+
+    double total = 0.0;
+    for (double lane : lanes) {
+        total += lane;
+    }
+    return total;
+}
+
+// Sum of max(0, end[i] - begin[i])
+double sumElapsed(const double* end, const double* begin, std::size_t count) {
+    double lanes[LANES] = {};
+    std::size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (std::size_t lane = 0; lane < LANES; ++lane) {
+            lanes[lane] += std::max(0.0, end[i + lane] - begin[i + lane]);
+        }
+    }
+    for (; i < count; ++i) {
+        lanes[0] += std::max(0.0, end[i] - begin[i]);
+    }
+
+    double total = 0.0;
+    for (double lane : lanes) {
+        total += lane;
+    }
+    return total;
+}
+} // namespace
+
+void JobTable::reserve(std::size_t count) {
+    ids_.reserve(count);
+    arrival_.reserve(count);
+    burst_.reserve(count);
+    priority_.reserve(count);
+    tenant_.reserve(count);
+    deadline_.reserve(count);
+    slo_.reserve(count);
+    start_.reserve(count);
+    finish_.reserve(count);
+}
+
+void JobTable::clear() {
+    ids_.clear();
+    arrival_.clear();
+    burst_.clear();
+    priority_.clear();
+    tenant_.clear();
+    deadline_.clear();
+    slo_.clear();
+    start_.clear();
+    finish_.clear();
+}
+
+void JobTable::append(const Job& job) {
+    ids_.push_back(job.getId());
+    arrival_.push_back(job.getArrivalTime());
+    burst_.push_back(job.getBurstTime());
+    priority_.push_back(job.getPriority());
+    tenant_.push_back(static_cast<std::uint16_t>(job.getTenant()));
+    deadline_.push_back(job.getDeadline());
+    slo_.push_back(static_cast<std::uint8_t>(job.getSloClass()));
+    start_.push_back(job.getStartTime());
+    finish_.push_back(job.getFinishTime());
+}
+
+void JobTable::append(const JobTable& other) {
+    ids_.insert(ids_.end(), other.ids_.begin(), other.ids_.end());
+    arrival_.insert(arrival_.end(), other.arrival_.begin(), other.arrival_.end());
+    burst_.insert(burst_.end(), other.burst_.begin(), other.burst_.end());
+    priority_.insert(priority_.end(), other.priority_.begin(), other.priority_.end());
+    tenant_.insert(tenant_.end(), other.tenant_.begin(), other.tenant_.end());
+    deadline_.insert(deadline_.end(), other.deadline_.begin(), other.deadline_.end());
+    slo_.insert(slo_.end(), other.slo_.begin(), other.slo_.end());
+    start_.insert(start_.end(), other.start_.begin(), other.start_.end());
+    finish_.insert(finish_.end(), other.finish_.begin(), other.finish_.end());
+}
+
+void JobTable::appendRow(const JobTable& other, std::size_t row) {
+    ids_.push_back(other.ids_[row]);
+    arrival_.push_back(other.arrival_[row]);
+    burst_.push_back(other.burst_[row]);
+    priority_.push_back(other.priority_[row]);
+    tenant_.push_back(other.tenant_[row]);
+    deadline_.push_back(other.deadline_[row]);
+    slo_.push_back(other.slo_[row]);
+    start_.push_back(other.start_[row]);
+    finish_.push_back(other.finish_[row]);
+}
+
+float JobTable::waitingTime(std::size_t row) const {
+    return static_cast<float>(std::max(0.0, start_[row] - arrival_[row]));
+}
+
+float JobTable::turnaroundTime(std::size_t row) const {
+    return static_cast<float>(std::max(0.0, finish_[row] - arrival_[row]));
+}
+
+Job JobTable::toJob(std::size_t row) const {
+    Job job(ids_[row], arrival_[row], burst_[row], priority_[row], tenant_[row]);
+    job.setStartTime(start_[row]);
+    job.setFinishTime(finish_[row]);
+    job.setRemainingTime(0.0f);
+    job.setState(JobState::FINISHED);
+    job.setDeadline(deadline_[row]);
+    job.setSloClass(static_cast<SloClass>(slo_[row]));
+    return job;
+}
+
+double JobTable::totalWaitingTime() const {
+    return sumElapsed(start_.data(), arrival_.data(), size());
+}
+
+double JobTable::totalTurnaroundTime() const {
+    return sumElapsed(finish_.data(), arrival_.data(), size());
+}
+
+double JobTable::totalBurstTime() const {
+    return sumColumn(burst_.data(), size());
+}
+
+double JobTable::earliestStart() const {
+    if (start_.empty()) {
+        return 0.0;
+    }
+    return *std::min_element(start_.begin(), start_.end());
+}
+
+double JobTable::latestFinish() const {
+    if (finish_.empty()) {
+        return 0.0;
+    }
+    return *std::max_element(finish_.begin(), finish_.end());
+}
+
+std::size_t JobTable::deadlineJobs() const {
+    return static_cast<std::size_t>(std::count_if(deadline_.begin(), deadline_.end(),
+                                                  [](double deadline) { return std::isfinite(deadline); }));
+}
+
+std::size_t JobTable::deadlineMisses() const {
+    std::size_t misses = 0;
+    for (std::size_t row = 0; row < size(); ++row) {
+        misses += finish_[row] > deadline_[row] ? 1 : 0;    // Never true for infinity
+    }
+    return misses;
+}
+
+bool JobTable::hasSloInfo() const {
+    return deadlineJobs() > 0 ||
+           std::any_of(slo_.begin(), slo_.end(), [](std::uint8_t slo) {
+               return slo != static_cast<std::uint8_t>(SloClass::STANDARD);
+           });
+}
+
+}
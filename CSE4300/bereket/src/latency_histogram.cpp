@@ -0,0 +1,192 @@
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace chronos {
+namespace {
+// Keep unit counts far from overflow when shifted back into a bucket bound
+constexpr std::uint64_t MAX_UNITS = 1ULL << 62;
+
+int highestBit(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+} // namespace
+
+LatencyHistogram::LatencyHistogram(double resolution)
+    : resolution_(resolution > 0.0 ? resolution : 1e-4)
+{
+}
+
+std::size_t LatencyHistogram::indexOf(std::uint64_t units) {
+    if (units < SUB_BUCKETS) {
+        return static_cast<std::size_t>(units);
+    }
+    // Keep the top SUB_BUCKET_BITS bits: [128, 255] << shift
+    const int shift = highestBit(units) - (SUB_BUCKET_BITS - 1);
+    const std::uint64_t top = units >> shift;
+    return static_cast<std::size_t>(SUB_BUCKETS + (shift - 1) * HALF_BUCKETS + (top - HALF_BUCKETS));
+}
+
+std::uint64_t LatencyHistogram::lowestUnits(std::size_t index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    const std::size_t offset = index - SUB_BUCKETS;
+    const int shift = static_cast<int>(offset / HALF_BUCKETS) + 1;
+    return (HALF_BUCKETS + offset % HALF_BUCKETS) << shift;
+}
+
+std::uint64_t LatencyHistogram::bucketWidth(std::size_t index) {
+    if (index < SUB_BUCKETS) {
+        return 1;
+    }
+    return 1ULL << ((index - SUB_BUCKETS) / HALF_BUCKETS + 1);
+}
+
+void LatencyHistogram::record(double value) {
+    if (!(value > 0.0)) {
+        value = 0.0;    // Negative and NaN both count as zero
+    }
+
+    const double scaled = value / resolution_;
+    const std::uint64_t units = scaled >= static_cast<double>(MAX_UNITS)
+                                    ? MAX_UNITS
+                                    : static_cast<std::uint64_t>(scaled);
+    const std::size_t index = indexOf(units);
+    if (index >= counts_.size()) {
+        counts_.resize(index + 1, 0);
+    }
+    ++counts_[index];
+
+    if (total_ == 0 || value < min_) {
+        min_ = value;
+    }
+    if (total_ == 0 || value > max_) {
+        max_ = value;
+    }
+    ++total_;
+    sum_ += value;
+}
+
+bool LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.total_ == 0) {
+        return true;
+    }
+    if (other.resolution_ != resolution_) {
+        return false;
+    }
+
+    if (other.counts_.size() > counts_.size()) {
+        counts_.resize(other.counts_.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.counts_.size(); ++i) {
+        counts_[i] += other.counts_[i];
+    }
+
+    min_ = total_ ? std::min(min_, other.min_) : other.min_;
+    max_ = total_ ? std::max(max_, other.max_) : other.max_;
+    total_ += other.total_;
+    sum_ += other.sum_;
+    return true;
+}
+
+bool LatencyHistogram::subtract(const LatencyHistogram& earlier) {
+    if (earlier.total_ == 0) {
+        return true;
+    }
+    if (earlier.resolution_ != resolution_ || earlier.total_ > total_ ||
+        earlier.counts_.size() > counts_.size()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < earlier.counts_.size(); ++i) {
+        counts_[i] -= earlier.counts_[i];
+    }
+    total_ -= earlier.total_;
+    sum_ -= earlier.sum_;
+    if (total_ == 0) {
+        reset();
+        return true;
+    }
+
+    // The exact extremes may have been subtracted: keep them only while they
+    // still fall within the occupied buckets
+    std::size_t first = 0;
+    while (counts_[first] == 0) {
+        ++first;
+    }
+    std::size_t last = counts_.size() - 1;
+    while (counts_[last] == 0) {
+        --last;
+    }
+    min_ = std::max(min_, static_cast<double>(lowestUnits(first)) * resolution_);
+    max_ = std::min(max_, static_cast<double>(lowestUnits(last) + bucketWidth(last)) * resolution_);
+    return true;
+}
+
+void LatencyHistogram::reset() {
+    counts_.clear();
+    total_ = 0;
+    sum_ = 0.0;
+    min_ = 0.0;
+    max_ = 0.0;
+}
+
+double LatencyHistogram::percentile(double p) const {
+    if (total_ == 0) {
+        return 0.0;
+    }
+
+    // Nearest-rank: smallest value with at least p% of samples at or below it
+    p = std::min(100.0, std::max(0.0, p));
+    std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total_)));
+    rank = std::min(total_, std::max<std::uint64_t>(1, rank));
+    if (rank == total_) {
+        return max_;
+    }
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+        seen += counts_[i];
+        if (seen >= rank) {
+            // Bucket midpoint, clamped to the exact extremes
+            const double mid = (static_cast<double>(lowestUnits(i)) +
+                                static_cast<double>(bucketWidth(i)) / 2.0) * resolution_;
+            return std::min(max_, std::max(min_, mid));
+        }
+    }
+    return max_;
+}
+
+void LatencyStats::record(double arrival, float burst, double start, double finish) {
+    const double turnaround_time = std::max(0.0, finish - arrival);
+    turnaround.record(turnaround_time);
+    ready.record(turnaround_time - burst);
+    response.record(start - arrival);
+    slowdown.record(burst > 0.0f ? turnaround_time / burst : 1.0);
+}
+
+void LatencyStats::merge(const LatencyStats& other) {
+    ready.merge(other.ready);
+    turnaround.merge(other.turnaround);
+    response.merge(other.response);
+    slowdown.merge(other.slowdown);
+}
+
+void LatencyStats::reset() {
+    ready.reset();
+    turnaround.reset();
+    response.reset();
+    slowdown.reset();
+}
+
+}
@@ -0,0 +1,287 @@
+#include "live_metrics.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace chronos {
+namespace {
+// Single-writer add: a relaxed load and store, no locked instruction
+template <typename T>
+void bump(std::atomic<T>& counter, T amount) {
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+std::string number(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.6g", std::isfinite(value) ? value : 0.0);
+    return buffer;
+}
+
+std::string quoted(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out + "\"";
+}
+} // namespace
+
+void LiveMetrics::begin(const std::string& label, int num_cores) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    num_cores_ = std::max(0, num_cores);
+    cores_ = std::make_unique<CoreCounters[]>(static_cast<std::size_t>(num_cores_));
+    label_ = label;
+    running_ = true;
+    ++run_;
+    queue_depth_.store(0, std::memory_order_relaxed);
+}
+
+void LiveMetrics::end() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int core = 0; core < num_cores_; ++core) {
+        publish(cores_[static_cast<std::size_t>(core)]);
+    }
+    running_ = false;
+    queue_depth_.store(0, std::memory_order_relaxed);
+}
+
+void LiveMetrics::recordSlice(int core, double start, double length) {
+    CoreCounters& counters = cores_[static_cast<std::size_t>(core)];
+    bump(counters.busy, length);
+    bump(counters.dispatches, std::uint64_t{1});
+    counters.clock.store(std::max(counters.clock.load(std::memory_order_relaxed), start + length),
+                         std::memory_order_relaxed);
+}
+
+void LiveMetrics::recordCompletion(int core, double turnaround) {
+    CoreCounters& counters = cores_[static_cast<std::size_t>(core)];
+    counters.turnaround.record(turnaround);
+    bump(counters.completed, std::uint64_t{1});
+    if (counters.copy_wanted.load(std::memory_order_relaxed)) {
+        publish(counters);
+    }
+}
+
+void LiveMetrics::publish(CoreCounters& counters) {
+    // Assignment reuses the copy's buffer, so this rarely allocates
+    std::lock_guard<std::mutex> lock(counters.copy_mutex);
+    counters.published = counters.turnaround;
+    counters.copy_wanted.store(false, std::memory_order_relaxed);
+}
+
+LiveSnapshot LiveMetrics::snapshot() const {
+    LiveSnapshot snapshot;
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot.run = run_;
+    snapshot.label = label_;
+    snapshot.running = running_;
+    snapshot.queue_depth = queue_depth_.load(std::memory_order_relaxed);
+    snapshot.busy.resize(static_cast<std::size_t>(num_cores_), 0.0);
+    for (int core = 0; core < num_cores_; ++core) {
+        CoreCounters& counters = cores_[static_cast<std::size_t>(core)];
+        snapshot.busy[static_cast<std::size_t>(core)] = counters.busy.load(std::memory_order_relaxed);
+        snapshot.sim_time = std::max(snapshot.sim_time, counters.clock.load(std::memory_order_relaxed));
+        snapshot.dispatches += counters.dispatches.load(std::memory_order_relaxed);
+        snapshot.completed += counters.completed.load(std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> copy_lock(counters.copy_mutex);
+            snapshot.turnaround.merge(counters.published);
+        }
+        counters.copy_wanted.store(true, std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+StatsPublisher::StatsPublisher(const LiveMetrics& metrics, std::chrono::milliseconds interval,
+                               std::size_t window)
+    : metrics_(metrics)
+    , interval_(interval)
+    , window_(std::max<std::size_t>(2, window))
+{
+}
+
+StatsPublisher::~StatsPublisher() {
+    stop();
+}
+
+bool StatsPublisher::start(const std::string& target) {
+    if (target.compare(0, 5, "unix:") == 0) {
+#ifdef __linux__
+        socket_path_ = target.substr(5);
+        sockaddr_un address{};
+        if (socket_path_.empty() || socket_path_.size() >= sizeof(address.sun_path)) {
+            std::cerr << "Error: Invalid socket path: " << socket_path_ << "\n";
+            return false;
+        }
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, socket_path_.c_str(), sizeof(address.sun_path) - 1);
+
+        // Non-blocking, so accepting clients never holds up a publish
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        ::unlink(socket_path_.c_str());
+        if (listen_fd_ < 0 ||
+            ::bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(listen_fd_, 8) != 0) {
+            std::cerr << "Error: Cannot listen on " << socket_path_ << ": " << std::strerror(errno)
+                      << "\n";
+            if (listen_fd_ >= 0) {
+                ::close(listen_fd_);
+                listen_fd_ = -1;
+            }
+            return false;
+        }
+#else
+        std::cerr << "Error: Unix socket stats are not supported on this platform\n";
+        return false;
+#endif
+    } else if (target != "stderr") {
+        std::cerr << "Error: Unknown live stats target: " << target << " (stderr or unix:PATH)\n";
+        return false;
+    }
+
+    started_ = std::chrono::steady_clock::now();
+    stopping_ = false;
+    thread_ = std::thread(&StatsPublisher::run, this);
+    return true;
+}
+
+void StatsPublisher::stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wakeup_.notify_all();
+    thread_.join();
+
+#ifdef __linux__
+    for (int client : clients_) {
+        ::close(client);
+    }
+    clients_.clear();
+    if (listen_fd_ >= 0) {
+        ::close(listen_fd_);
+        ::unlink(socket_path_.c_str());
+        listen_fd_ = -1;
+    }
+#endif
+}
+
+void StatsPublisher::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        wakeup_.wait_for(lock, interval_, [this] { return stopping_; });
+        lock.unlock();
+        publish();
+        lock.lock();
+    }
+}
+
+void StatsPublisher::publish() {
+    Sample sample{std::chrono::steady_clock::now(), metrics_.snapshot()};
+    if (sample.snapshot.run == 0) {
+        return;     // No run started yet
+    }
+
+    // The window only spans snapshots of the same run
+    if (!samples_.empty() && samples_.back().snapshot.run != sample.snapshot.run) {
+        samples_.clear();
+    }
+    samples_.push_back(std::move(sample));
+    while (samples_.size() > window_) {
+        samples_.pop_front();
+    }
+    send(format(samples_.back(), samples_.front()));
+}
+
+std::string StatsPublisher::format(const Sample& newest, const Sample& oldest) const {
+    const LiveSnapshot& now = newest.snapshot;
+    const LiveSnapshot& then = oldest.snapshot;
+    const double wall = std::chrono::duration<double>(newest.at - started_).count();
+    const double wall_span = std::chrono::duration<double>(newest.at - oldest.at).count();
+    const double sim_span = now.sim_time - then.sim_time;
+    const auto completed = static_cast<double>(now.completed - then.completed);
+
+    std::ostringstream out;
+    out << "{\"wall\":" << number(wall)
+        << ",\"run\":" << now.run
+        << ",\"policy\":" << quoted(now.label)
+        << ",\"state\":\"" << (now.running ? "running" : "done") << "\""
+        << ",\"sim_time\":" << number(now.sim_time)
+        << ",\"completed\":" << now.completed
+        << ",\"dispatches\":" << now.dispatches
+        << ",\"queue_depth\":" << now.queue_depth
+        << ",\"window\":" << number(wall_span)
+        << ",\"throughput\":" << number(wall_span > 0.0 ? completed / wall_span : 0.0)
+        << ",\"sim_throughput\":" << number(sim_span > 0.0 ? completed / sim_span : 0.0);
+
+    // Busy share of the window's simulated time, per core
+    out << ",\"utilization\":[";
+    for (std::size_t core = 0; core < now.busy.size(); ++core) {
+        const double busy = now.busy[core] - (core < then.busy.size() ? then.busy[core] : 0.0);
+        out << (core > 0 ? "," : "")
+            << number(sim_span > 0.0 ? std::min(1.0, busy / sim_span) : 0.0);
+    }
+    out << "]";
+
+    // Quantiles of the jobs that finished within the window, or of the whole
+    // run until a window has any
+    LatencyHistogram turnaround = now.turnaround;
+    if (oldest.at != newest.at && now.turnaround.count() > then.turnaround.count()) {
+        turnaround.subtract(then.turnaround);
+    }
+    out << ",\"turnaround_p50\":" << number(turnaround.percentile(50.0))
+        << ",\"turnaround_p99\":" << number(turnaround.percentile(99.0))
+        << ",\"turnaround_p999\":" << number(turnaround.percentile(99.9)) << "}\n";
+    return out.str();
+}
+
+void StatsPublisher::send(const std::string& line) {
+    if (listen_fd_ < 0) {
+        std::cerr << line << std::flush;
+        return;
+    }
+
+#ifdef __linux__
+    while (true) {
+        const int client = ::accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client < 0) {
+            break;
+        }
+        clients_.push_back(client);
+    }
+
+    // A client that cannot take a whole line right now is dropped rather
+    // than allowed to stall the publisher
+    clients_.erase(std::remove_if(clients_.begin(), clients_.end(),
+                                  [&line](int client) {
+                                      const ssize_t sent = ::send(client, line.data(), line.size(),
+                                                                  MSG_NOSIGNAL | MSG_DONTWAIT);
+                                      if (sent == static_cast<ssize_t>(line.size())) {
+                                          return false;
+                                      }
+                                      ::close(client);
+                                      return true;
+                                  }),
+                   clients_.end());
+#endif
+}
+
+}
@@ -6,9 +6,7 @@
 namespace chronos {
 
 MetricsCollector::MetricsCollector()
-    : total_waiting_time_(0.0f)
-    , total_turnaround_time_(0.0f)
-    , cpu_active_time_(0.0f)
+    : cpu_active_time_(0.0f)
     , idle_time_(0.0f)
     , makespan_(0.0f)
     , num_cores_(1)
@@ -17,9 +15,19 @@ MetricsCollector::MetricsCollector()
 }
 
 void MetricsCollector::recordJobCompletion(const Job& job) {
-    completed_jobs_.push_back(job);
-    total_waiting_time_ += job.getWaitingTime();
-    total_turnaround_time_ += job.getTurnaroundTime();
+    completed_jobs_.append(job);
+    latency_.record(job.getArrivalTime(), job.getBurstTime(),
+                    job.getStartTime(), job.getFinishTime());
+}
+
+void MetricsCollector::setCompletedJobs(JobTable jobs) {
+    completed_jobs_ = std::move(jobs);
+
+    latency_.reset();
+    for (std::size_t row = 0; row < completed_jobs_.size(); ++row) {
+        latency_.record(completed_jobs_.arrivalTime(row), completed_jobs_.burstTime(row),
+                        completed_jobs_.startTime(row), completed_jobs_.finishTime(row));
+    }
 }
 
 void MetricsCollector::recordJobCompletionThreadSafe(const Job& job) {
@@ -40,14 +48,31 @@ void MetricsCollector::recordIdleTime(float duration) {
 }
 
 void MetricsCollector::recordContextSwitch() {
-    dispatch_count_++;
+    dispatch_count_.fetch_add(1, std::memory_order_relaxed);
 }
 
 void MetricsCollector::recordContextSwitchThreadSafe() {
-    std::lock_guard<std::mutex> lock(metrics_mutex_);
     recordContextSwitch();
 }
 
+void MetricsCollector::merge(const MetricsCollector& other) {
+    if (&other == this) {
+        return;
+    }
+    std::scoped_lock lock(metrics_mutex_, other.metrics_mutex_);
+    completed_jobs_.append(other.completed_jobs_);
+    latency_.merge(other.latency_);
+    cpu_active_time_ += other.cpu_active_time_;
+    idle_time_ += other.idle_time_;
+    dispatch_count_.fetch_add(other.dispatch_count_.load(std::memory_order_relaxed),
+                              std::memory_order_relaxed);
+}
+
+double MetricsCollector::getPerfPerWatt() const {
+    const double joules = energy_.joules();
+    return joules > 0.0 ? static_cast<double>(completed_jobs_.size()) / joules : 0.0;
+}
+
 void MetricsCollector::setMakespan(float makespan) {
     makespan_ = makespan;
 }
@@ -64,12 +89,20 @@ void MetricsCollector::setNumCores(int cores) {
     num_cores_ = cores > 0 ? cores : 1;
 }
 
+float MetricsCollector::getTotalWaitingTime() const {
+    return static_cast<float>(completed_jobs_.totalWaitingTime());
+}
+
+float MetricsCollector::getTotalTurnaroundTime() const {
+    return static_cast<float>(completed_jobs_.totalTurnaroundTime());
+}
+
 float MetricsCollector::getAverageWaitingTime() const {
-    return calculateAverage(total_waiting_time_, completed_jobs_.size());
+    return calculateAverage(getTotalWaitingTime(), completed_jobs_.size());
 }
 
 float MetricsCollector::getAverageTurnaroundTime() const {
-    return calculateAverage(total_turnaround_time_, completed_jobs_.size());
+    return calculateAverage(getTotalTurnaroundTime(), completed_jobs_.size());
 }
 
 float MetricsCollector::getCpuUtilization() const {
@@ -83,24 +116,67 @@ float MetricsCollector::getCpuUtilization() const {
     return std::min(1.0f, cpu_active_time_ / (makespan_ * static_cast<float>(num_cores_)));
 }
 
+std::vector<TenantMetrics> MetricsCollector::tenantBreakdown(const JobTable& jobs, float makespan) {
+    // Dense by tenant id, then compacted to the tenants that finished jobs
+    std::vector<TenantMetrics> tenants;
+    for (std::size_t row = 0; row < jobs.size(); ++row) {
+        const std::size_t id = static_cast<std::size_t>(jobs.tenant(row));
+        if (id >= tenants.size()) {
+            tenants.resize(id + 1);
+        }
+        TenantMetrics& tenant = tenants[id];
+        tenant.tenant = static_cast<int>(id);
+        ++tenant.jobs;
+        tenant.cpu_time += jobs.burstTime(row);
+        tenant.total_waiting += jobs.waitingTime(row);
+        tenant.total_turnaround += jobs.turnaroundTime(row);
+        tenant.latency.record(jobs.arrivalTime(row), jobs.burstTime(row), jobs.startTime(row),
+                              jobs.finishTime(row));
+    }
+
+    tenants.erase(std::remove_if(tenants.begin(), tenants.end(),
+                                 [](const TenantMetrics& tenant) { return tenant.jobs == 0; }),
+                  tenants.end());
+    for (TenantMetrics& tenant : tenants) {
+        tenant.throughput = makespan > 0.0f ? static_cast<float>(tenant.jobs) / makespan : 0.0f;
+    }
+    return tenants;
+}
+
+std::size_t MetricsCollector::getTenantCount() const {
+    std::vector<bool> seen;
+    std::size_t count = 0;
+    for (std::uint16_t id : completed_jobs_.tenants()) {
+        if (id >= seen.size()) {
+            seen.resize(static_cast<std::size_t>(id) + 1, false);
+        }
+        if (!seen[id]) {
+            seen[id] = true;
+            ++count;
+        }
+    }
+    return count;
+}
+
 std::size_t MetricsCollector::getContextSwitches() const {
     // Context switches = dispatches - num_cores (initial dispatches to each core don't count)
     // Example: 2 cores, 5 jobs → 5 dispatches → 5 - 2 = 3 context switches
-    if (dispatch_count_ <= static_cast<std::size_t>(num_cores_)) {
+    const std::size_t dispatches = dispatch_count_.load(std::memory_order_relaxed);
+    if (dispatches <= static_cast<std::size_t>(num_cores_)) {
         return 0;
     }
-    return dispatch_count_ - static_cast<std::size_t>(num_cores_);
+    return dispatches - static_cast<std::size_t>(num_cores_);
 }
 
 void MetricsCollector::reset() {
     std::lock_guard<std::mutex> lock(metrics_mutex_);
     completed_jobs_.clear();
-    total_waiting_time_ = 0.0f;
-    total_turnaround_time_ = 0.0f;
+    latency_.reset();
     cpu_active_time_ = 0.0f;
     idle_time_ = 0.0f;
     makespan_ = 0.0f;
     num_cores_ = 1;
+    energy_ = EnergyStats();
     dispatch_count_ = 0;
 }
 
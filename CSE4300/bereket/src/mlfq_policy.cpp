@@ -0,0 +1,120 @@
+#include "mlfq_policy.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace chronos {
+
+MLFQPolicy::MLFQPolicy(int base_quantum, int levels, float boost_interval)
+    : base_quantum_(base_quantum)
+    , levels_(levels)
+    , boost_interval_(boost_interval > 0.0f ? boost_interval : 20.0f * static_cast<float>(base_quantum))
+{
+    if (base_quantum_ <= 0) {
+        throw std::invalid_argument("MLFQPolicy requires a positive quantum.");
+    }
+    if (levels_ < 1 || levels_ > 16) {
+        throw std::invalid_argument("MLFQPolicy requires between 1 and 16 levels.");
+    }
+}
+
+float MLFQPolicy::quantum(int level) const {
+    level = std::max(0, std::min(level, levels_ - 1));
+    return static_cast<float>(base_quantum_) * static_cast<float>(1 << level);
+}
+
+Job* MLFQPolicy::getNextJob(std::vector<Job>& ready_queue) {
+    auto it = std::min_element(ready_queue.begin(), ready_queue.end(),
+                               [](const Job& a, const Job& b) {
+                                   if (a.getQueueLevel() != b.getQueueLevel()) {
+                                       return a.getQueueLevel() < b.getQueueLevel();
+                                   }
+                                   if (a.getArrivalTime() != b.getArrivalTime()) {
+                                       return a.getArrivalTime() < b.getArrivalTime();
+                                   }
+                                   return a.getId() < b.getId();
+                               });
+    return it != ready_queue.end() ? &(*it) : nullptr;
+}
+
+void MLFQPolicy::onJobCompletion(Job* completed_job, double current_time) {
+    // Only ever moves forward; several cores may report at once
+    const auto epoch = static_cast<std::uint64_t>(std::max(0.0, current_time) / boost_interval_);
+    std::uint64_t seen = boost_epoch_.load(std::memory_order_relaxed);
+    while (epoch > seen &&
+           !boost_epoch_.compare_exchange_weak(seen, epoch, std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+    }
+
+    // Back in the ready state after a slice means it used its whole quantum;
+    // a job that blocks for I/O first keeps its level
+    if (completed_job && completed_job->getState() == JobState::READY) {
+        const int level = completed_job->getQueueLevel();
+        if (level + 1 < levels_) {
+            completed_job->setQueueLevel(static_cast<std::uint8_t>(level + 1));
+        }
+    }
+}
+
+std::unique_ptr<ReadyQueue> MLFQPolicy::createReadyQueue() {
+    return std::make_unique<MLFQReadyQueue>(*this);
+}
+
+MLFQReadyQueue::MLFQReadyQueue(const MLFQPolicy& policy)
+    : policy_(policy)
+    , levels_(static_cast<std::size_t>(policy.getLevels()))
+    , seen_epoch_(policy.boostEpoch())
+{
+}
+
+void MLFQReadyQueue::boostIfDue() {
+    const std::uint64_t epoch = policy_.boostEpoch();
+    if (epoch == seen_epoch_) {
+        return;
+    }
+    seen_epoch_ = epoch;
+
+    FifoReadyQueue& top = levels_.front();
+    for (std::size_t level = 1; level < levels_.size(); ++level) {
+        Job job(0, 0.0f, 0.0f);
+        while (levels_[level].pop(job)) {
+            job.setQueueLevel(0);
+            top.push(std::move(job));
+        }
+    }
+}
+
+void MLFQReadyQueue::push(Job job) {
+    boostIfDue();
+    const std::size_t level = std::min<std::size_t>(job.getQueueLevel(), levels_.size() - 1);
+    levels_[level].push(std::move(job));
+    ++size_;
+}
+
+bool MLFQReadyQueue::pop(Job& out) {
+    boostIfDue();
+    for (auto& level : levels_) {
+        if (level.pop(out)) {
+            --size_;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MLFQReadyQueue::remove(int job_id, Job& out) {
+    for (auto& level : levels_) {
+        if (level.remove(job_id, out)) {
+            --size_;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MLFQReadyQueue::contains(int job_id) const {
+    return std::any_of(levels_.begin(), levels_.end(),
+                       [job_id](const FifoReadyQueue& level) { return level.contains(job_id); });
+}
+
+}
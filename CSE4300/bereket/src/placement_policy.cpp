@@ -0,0 +1,147 @@
+#include "placement_policy.h"
+
+#include <algorithm>
+
+namespace chronos {
+namespace {
+// Ties go to the lowest core index
+int leastLoaded(const std::vector<std::size_t>& queue_lengths) {
+    auto it = std::min_element(queue_lengths.begin(), queue_lengths.end());
+    return it == queue_lengths.end() ? 0 : static_cast<int>(it - queue_lengths.begin());
+}
+
+// Shortest queue, scanning from core `start` so ties rotate between calls
+int leastLoadedFrom(const std::vector<std::size_t>& queue_lengths, std::size_t& start) {
+    const std::size_t num_cores = queue_lengths.size();
+    if (num_cores == 0) {
+        return 0;
+    }
+    std::size_t best = start % num_cores;
+    for (std::size_t step = 1; step < num_cores; ++step) {
+        const std::size_t core = (start + step) % num_cores;
+        if (queue_lengths[core] < queue_lengths[best]) {
+            best = core;
+        }
+    }
+    start = best + 1;
+    return static_cast<int>(best);
+}
+
+// Shortest queue on node; preferred (a core on that node) wins ties
+int shortestOnNode(const std::vector<std::size_t>& queue_lengths, const Topology& topology,
+                   int node, int preferred) {
+    const int num_cores = static_cast<int>(queue_lengths.size());
+    int best = preferred;
+    for (int core = 0; core < num_cores; ++core) {
+        if (topology.nodeOf(core, num_cores) == node && queue_lengths[core] < queue_lengths[best]) {
+            best = core;
+        }
+    }
+    return best;
+}
+
+// Non-empty queue with the most jobs among cores allowed(core), skipping the thief
+template <typename Allowed>
+int busiestPeer(int thief_core, const std::vector<std::size_t>& queue_lengths, Allowed allowed) {
+    int victim = -1;
+    std::size_t victim_length = 0;
+    for (int core = 0; core < static_cast<int>(queue_lengths.size()); ++core) {
+        if (core == thief_core || !allowed(core)) {
+            continue;
+        }
+        if (queue_lengths[core] > victim_length) {
+            victim = core;
+            victim_length = queue_lengths[core];
+        }
+    }
+    return victim;
+}
+} // namespace
+
+int RoundRobinPlacement::placeJob(const Job& /*job*/, const std::vector<std::size_t>& queue_lengths) {
+    if (queue_lengths.empty()) {
+        return 0;
+    }
+    const std::size_t core = next_core_ % queue_lengths.size();
+    next_core_ = core + 1;
+    return static_cast<int>(core);
+}
+
+int LeastLoadedPlacement::placeJob(const Job& /*job*/, const std::vector<std::size_t>& queue_lengths) {
+    return leastLoaded(queue_lengths);
+}
+
+int PlacementPolicy::requeueJob(const Job& job, const std::vector<std::size_t>& /*queue_lengths*/) const {
+    return job.getLastCore();
+}
+
+int PlacementPolicy::stealFrom(int thief_core, const std::vector<std::size_t>& queue_lengths) const {
+    return busiestPeer(thief_core, queue_lengths, [](int) { return true; });
+}
+
+int SoftAffinityPlacement::placeJob(const Job& /*job*/, const std::vector<std::size_t>& queue_lengths) {
+    return leastLoadedFrom(queue_lengths, next_core_);
+}
+
+int SoftAffinityPlacement::requeueJob(const Job& job, const std::vector<std::size_t>& queue_lengths) const {
+    const int last_core = job.getLastCore();
+    const int num_cores = static_cast<int>(queue_lengths.size());
+    if (last_core < 0 || last_core >= num_cores) {
+        return leastLoaded(queue_lengths);
+    }
+
+    const int node = topology_.nodeOf(last_core, num_cores);
+    const int shortest = shortestOnNode(queue_lengths, topology_, node, last_core);
+    if (queue_lengths[last_core] > queue_lengths[shortest] + MAX_IMBALANCE) {
+        return shortest;
+    }
+    return last_core;
+}
+
+int HardAffinityPlacement::placeJob(const Job& /*job*/, const std::vector<std::size_t>& queue_lengths) {
+    return leastLoadedFrom(queue_lengths, next_core_);
+}
+
+int NumaLocalPlacement::placeJob(const Job& /*job*/, const std::vector<std::size_t>& queue_lengths) {
+    return leastLoadedFrom(queue_lengths, next_core_);
+}
+
+int NumaLocalPlacement::requeueJob(const Job& job, const std::vector<std::size_t>& queue_lengths) const {
+    const int last_core = job.getLastCore();
+    const int num_cores = static_cast<int>(queue_lengths.size());
+    if (last_core < 0 || last_core >= num_cores) {
+        return leastLoaded(queue_lengths);
+    }
+    return shortestOnNode(queue_lengths, topology_, topology_.nodeOf(last_core, num_cores), last_core);
+}
+
+int NumaLocalPlacement::stealFrom(int thief_core, const std::vector<std::size_t>& queue_lengths) const {
+    const int num_cores = static_cast<int>(queue_lengths.size());
+    const int node = topology_.nodeOf(thief_core, num_cores);
+    const int local = busiestPeer(thief_core, queue_lengths, [&](int core) {
+        return topology_.nodeOf(core, num_cores) == node;
+    });
+    if (local >= 0) {
+        return local;
+    }
+    return busiestPeer(thief_core, queue_lengths, [](int) { return true; });
+}
+
+std::unique_ptr<PlacementPolicy> createPlacementPolicy(PlacementStrategy strategy,
+                                                       const Topology& topology) {
+    switch (strategy) {
+        case PlacementStrategy::LEAST_LOADED:
+            return std::make_unique<LeastLoadedPlacement>();
+        case PlacementStrategy::SOFT_AFFINITY:
+            return std::make_unique<SoftAffinityPlacement>(topology);
+        case PlacementStrategy::HARD_AFFINITY:
+            return std::make_unique<HardAffinityPlacement>();
+        case PlacementStrategy::NUMA_LOCAL:
+            return std::make_unique<NumaLocalPlacement>(topology);
+        case PlacementStrategy::ROUND_ROBIN:
+        default:
+            return std::make_unique<RoundRobinPlacement>();
+    }
+}
+
+}
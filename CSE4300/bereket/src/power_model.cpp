@@ -0,0 +1,114 @@
+#include "power_model.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
+namespace chronos {
+namespace {
+std::string upper(std::string str) {
+    std::transform(str.begin(), str.end(), str.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+    return str;
+}
+} // namespace
+
+const CoreType& PowerConfig::coreType(int core_id) const {
+    const std::size_t index = std::min(static_cast<std::size_t>(std::max(0, core_id)), cores.size() - 1);
+    return cores[index];
+}
+
+float CoreType::joulesPerWork(float frequency) const {
+    return PowerConfig::activePower(*this, frequency) / (speed * frequency);
+}
+
+float PowerConfig::activePower(const CoreType& type, float frequency) {
+    const float dynamic = type.active_watts - type.idle_watts;
+    return type.idle_watts + dynamic * frequency * frequency * frequency;
+}
+
+std::size_t PowerConfig::pickLevel(int running, std::size_t queued, int num_cores) const {
+    const std::size_t top = frequencies.size() - 1;
+    switch (governor) {
+        case Governor::POWERSAVE:
+            return 0;
+        case Governor::ONDEMAND: {
+            const float load = static_cast<float>(static_cast<std::size_t>(running) + queued) /
+                               static_cast<float>(std::max(1, num_cores));
+            for (std::size_t level = 0; level < top; ++level) {
+                if (frequencies[level] >= load) {
+                    return level;
+                }
+            }
+            return top;
+        }
+        case Governor::PERFORMANCE:
+        default:
+            return top;
+    }
+}
+
+std::string governorToString(Governor governor) {
+    switch (governor) {
+        case Governor::PERFORMANCE: return "performance";
+        case Governor::POWERSAVE:   return "powersave";
+        case Governor::ONDEMAND:    return "ondemand";
+        default:                    return "Unknown";
+    }
+}
+
+std::optional<Governor> stringToGovernor(const std::string& str) {
+    const std::string upper_str = upper(str);
+    if (upper_str == "PERFORMANCE") {
+        return Governor::PERFORMANCE;
+    } else if (upper_str == "POWERSAVE") {
+        return Governor::POWERSAVE;
+    } else if (upper_str == "ONDEMAND") {
+        return Governor::ONDEMAND;
+    }
+    return std::nullopt;
+}
+
+std::string energyPlacementToString(EnergyPlacement placement) {
+    switch (placement) {
+        case EnergyPlacement::IN_ORDER:     return "in-order";
+        case EnergyPlacement::FASTEST:      return "fastest";
+        case EnergyPlacement::EFFICIENT:    return "efficient";
+        case EnergyPlacement::ENERGY_AWARE: return "energy";
+        default:                            return "Unknown";
+    }
+}
+
+std::optional<EnergyPlacement> stringToEnergyPlacement(const std::string& str) {
+    const std::string upper_str = upper(str);
+    if (upper_str == "IN-ORDER" || upper_str == "INORDER") {
+        return EnergyPlacement::IN_ORDER;
+    } else if (upper_str == "FASTEST") {
+        return EnergyPlacement::FASTEST;
+    } else if (upper_str == "EFFICIENT") {
+        return EnergyPlacement::EFFICIENT;
+    } else if (upper_str == "ENERGY" || upper_str == "ENERGY-AWARE") {
+        return EnergyPlacement::ENERGY_AWARE;
+    }
+    return std::nullopt;
+}
+
+std::string coreTypesToString(const std::vector<CoreType>& cores) {
+    // Runs of the same type collapse to COUNTxNAME
+    std::ostringstream out;
+    for (std::size_t i = 0; i < cores.size();) {
+        std::size_t run = 1;
+        while (i + run < cores.size() && cores[i + run].name == cores[i].name &&
+               cores[i + run].speed == cores[i].speed &&
+               cores[i + run].active_watts == cores[i].active_watts &&
+               cores[i + run].idle_watts == cores[i].idle_watts) {
+            ++run;
+        }
+        out << (i ? ", " : "") << run << "x " << cores[i].name << " (speed " << cores[i].speed
+            << ", " << cores[i].active_watts << " W active, " << cores[i].idle_watts << " W idle)";
+        i += run;
+    }
+    return out.str();
+}
+
+}
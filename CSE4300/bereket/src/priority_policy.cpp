@@ -1,4 +1,5 @@
 #include "priority_policy.h"
+#include "heap_ready_queue.h"
 #include <algorithm>
 
 namespace chronos {
@@ -8,21 +9,27 @@ Job* PriorityPolicy::getNextJob(std::vector<Job>& ready_queue) {
         return nullptr;
     }
 
-    auto it = std::max_element(
-        ready_queue.begin(),
-        ready_queue.end(),
-        [](const Job& a, const Job& b) {
-            if (a.getPriority() != b.getPriority()) {
-                return a.getPriority() < b.getPriority();          
-            }
-            if (a.getArrivalTime() != b.getArrivalTime()) {
-                return a.getArrivalTime() > b.getArrivalTime();    
-            }
-            return a.getId() > b.getId();                   
-        }
-    );
+    auto it = std::min_element(ready_queue.begin(), ready_queue.end(), PriorityOrder{});
 
     return (it != ready_queue.end()) ? &(*it) : nullptr;
 }
 
+std::unique_ptr<ReadyQueue> PriorityPolicy::createReadyQueue() {
+    return std::make_unique<HeapReadyQueue<PriorityOrder>>();
+}
+
+Job* PreemptivePriorityPolicy::getNextJob(std::vector<Job>& ready_queue) {
+    if (ready_queue.empty()) {
+        return nullptr;
+    }
+
+    auto it = std::min_element(ready_queue.begin(), ready_queue.end(), PriorityOrder{});
+
+    return (it != ready_queue.end()) ? &(*it) : nullptr;
+}
+
+std::unique_ptr<ReadyQueue> PreemptivePriorityPolicy::createReadyQueue() {
+    return std::make_unique<HeapReadyQueue<PriorityOrder>>();
+}
+
 } 
\ No newline at end of file
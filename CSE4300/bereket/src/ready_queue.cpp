@@ -0,0 +1,85 @@
+#include "ready_queue.h"
+#include "scheduling_policy.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace chronos {
+
+std::unique_ptr<ReadyQueue> ISchedulingPolicy::createReadyQueue() {
+    return std::make_unique<ScanReadyQueue>(*this);
+}
+
+std::size_t ISchedulingPolicy::pickBatch(std::vector<Job>& ready_queue, std::size_t k,
+                                         std::vector<Job>& out) {
+    std::size_t picked = 0;
+    while (picked < k) {
+        Job* selected = getNextJob(ready_queue);
+        if (!selected) {
+            break;
+        }
+        const auto index = selected - ready_queue.data();
+        out.push_back(std::move(*selected));
+        ready_queue.erase(ready_queue.begin() + index);
+        ++picked;
+    }
+    return picked;
+}
+
+std::size_t ReadyQueue::popBatch(std::size_t k, std::vector<Job>& out) {
+    std::size_t popped = 0;
+    Job job(0, 0.0f, 0.0f);
+    while (popped < k && pop(job)) {
+        out.push_back(std::move(job));
+        ++popped;
+    }
+    return popped;
+}
+
+ScanReadyQueue::ScanReadyQueue(ISchedulingPolicy& policy)
+    : policy_(policy)
+{
+}
+
+void ScanReadyQueue::push(Job job) {
+    jobs_.push_back(std::move(job));
+}
+
+bool ScanReadyQueue::pop(Job& out) {
+    if (jobs_.empty()) {
+        return false;
+    }
+
+    Job* selected = policy_.getNextJob(jobs_);
+    if (!selected) {
+        return false;
+    }
+
+    const auto index = selected - jobs_.data();
+    out = std::move(*selected);
+    jobs_.erase(jobs_.begin() + index);
+    return true;
+}
+
+std::size_t ScanReadyQueue::popBatch(std::size_t k, std::vector<Job>& out) {
+    return policy_.pickBatch(jobs_, k, out);
+}
+
+bool ScanReadyQueue::remove(int job_id, Job& out) {
+    auto it = std::find_if(jobs_.begin(), jobs_.end(),
+                           [job_id](const Job& job) { return job.getId() == job_id; });
+    if (it == jobs_.end()) {
+        return false;
+    }
+
+    out = std::move(*it);
+    jobs_.erase(it);
+    return true;
+}
+
+bool ScanReadyQueue::contains(int job_id) const {
+    return std::any_of(jobs_.begin(), jobs_.end(),
+                       [job_id](const Job& job) { return job.getId() == job_id; });
+}
+
+}
@@ -1,10 +1,21 @@
 #include "scheduler_engine.h"
+#include "cfs_policy.h"
+#include "cycle_clock.h"
+#include "event_simulator.h"
+#include "fcfs_policy.h"
+#include "mlfq_policy.h"
+#include "metrics_collector.h"
+#include "priority_policy.h"
+#include "rr_policy.h"
+#include "sjf_policy.h"
+#include "srtf_policy.h"
+#include "edf_policy.h"
 #include "worker_pool.h"
 
 #include <algorithm>
-#include <deque>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -18,9 +29,66 @@ bool arrivalLess(const Job& lhs, const Job& rhs) {
     }
     return lhs.getId() < rhs.getId();
 }
+
+template <typename Policy>
+void simulate(Policy& policy, const std::vector<Job>& jobs, int num_cores, TraceWriter* trace,
+              const EngineConfig& config, AdmissionController* admission, ScheduleResult& result) {
+    BasicEventSimulator<Policy> simulator(policy, num_cores, trace, config.cost, config.topology,
+                                          config.io_depth);
+    simulator.setLiveMetrics(config.live);
+    simulator.setAdmission(admission);
+    simulator.setPower(config.power);
+    simulator.run(jobs, result);
+}
+
+// Simulate on the instantiation for whichever of Policies `policy` is.
+// Returns false if it is none of them.
+template <typename Policy, typename... Others>
+bool simulateAs(ISchedulingPolicy& policy, const std::vector<Job>& jobs, int num_cores,
+                TraceWriter* trace, const EngineConfig& config, AdmissionController* admission,
+                ScheduleResult& result) {
+    if (auto* concrete = dynamic_cast<Policy*>(&policy)) {
+        simulate(*concrete, jobs, num_cores, trace, config, admission, result);
+        return true;
+    }
+    if constexpr (sizeof...(Others) > 0) {
+        return simulateAs<Others...>(policy, jobs, num_cores, trace, config, admission, result);
+    }
+    return false;
+}
 } // namespace
 
-ScheduleResult SchedulerEngine::run(std::vector<Job> jobs, ISchedulingPolicy& policy, int num_cores) {
+SchedulerEngine::SchedulerEngine(EngineMode mode)
+    : config_()
+{
+    config_.mode = mode;
+}
+
+SchedulerEngine::SchedulerEngine(const EngineConfig& config)
+    : config_(config)
+{
+}
+
+void SchedulerEngine::sortByArrival(std::vector<Job>& jobs) {
+    std::sort(jobs.begin(), jobs.end(), arrivalLess);
+}
+
+ScheduleResult SchedulerEngine::run(std::vector<Job>&& jobs, ISchedulingPolicy& policy, int num_cores) {
+    sortByArrival(jobs);
+    return runSorted(jobs, &jobs, policy, num_cores);
+}
+
+ScheduleResult SchedulerEngine::run(const std::vector<Job>& jobs, ISchedulingPolicy& policy,
+                                    int num_cores) {
+    if (!std::is_sorted(jobs.begin(), jobs.end(), arrivalLess)) {
+        std::vector<Job> sorted = jobs;
+        return run(std::move(sorted), policy, num_cores);
+    }
+    return runSorted(jobs, nullptr, policy, num_cores);
+}
+
+ScheduleResult SchedulerEngine::runSorted(const std::vector<Job>& jobs, std::vector<Job>* owned,
+                                          ISchedulingPolicy& policy, int num_cores) {
     ScheduleResult result;
 
     if (jobs.empty()) {
@@ -33,37 +101,92 @@ ScheduleResult SchedulerEngine::run(std::vector<Job> jobs, ISchedulingPolicy& po
         return result;
     }
 
-    // Sort jobs by arrival time
-    std::sort(jobs.begin(), jobs.end(), arrivalLess);
-    const float simulation_start = jobs.front().getArrivalTime();
+    const double simulation_start = jobs.front().getArrivalTime();
+    result.completed_jobs.reserve(jobs.size());
 
+    if (config_.live) {
+        config_.live->begin(policy.getName(), num_cores);
+    }
+    const std::unique_ptr<AdmissionController> admission = createAdmissionController(config_.admission);
+    if (config_.mode == EngineMode::DISCRETE_EVENT) {
+        runEventDriven(jobs, policy, num_cores, admission.get(), result);
+    } else {
+        // Worker threads consume their jobs: take the caller's, or a copy
+        if (owned) {
+            runThreaded(std::move(*owned), policy, num_cores, admission.get(), result);
+        } else {
+            runThreaded(jobs, policy, num_cores, admission.get(), result);
+        }
+    }
+    if (admission) {
+        result.admission = admission->stats();
+    }
+    if (config_.live) {
+        config_.live->end();
+    }
+
+    result.num_cores = num_cores;
+    aggregateMetrics(result, simulation_start);
+
+    if (config_.print_summary) {
+        printSummary(result, policy);
+    }
+    return result;
+}
+
+void SchedulerEngine::runEventDriven(const std::vector<Job>& jobs, ISchedulingPolicy& policy,
+                                     int num_cores, AdmissionController* admission,
+                                     ScheduleResult& result) {
+    // The policy's type is checked once per run, not per event
+    if (config_.dispatch == DispatchMode::STATIC &&
+        simulateAs<FCFSPolicy, SJFPolicy, PriorityPolicy, PreemptivePriorityPolicy, RoundRobinPolicy,
+                   MLFQPolicy, CFSPolicy, SRTFPolicy, EDFPolicy>(policy, jobs, num_cores, trace_,
+                                                                 config_, admission, result)) {
+        return;
+    }
+    simulate(policy, jobs, num_cores, trace_, config_, admission, result);
+}
+
+void SchedulerEngine::runThreaded(std::vector<Job> jobs, ISchedulingPolicy& policy, int num_cores,
+                                  AdmissionController* admission, ScheduleResult& result) {
     // Shared data structures
-    std::vector<Job> ready_queue;
-    ready_queue.reserve(jobs.size());
-    result.completed_jobs.reserve(jobs.size());
+    std::unique_ptr<ReadyQueue> ready_queue = policy.createReadyQueue();
     
-    // Shared storage for completed jobs (thread-safe)
-    std::vector<Job> completed_jobs_shared;
-    completed_jobs_shared.reserve(jobs.size());
-    std::mutex completed_mutex;
+    // Workers buffer completions per core; stop() merges them in here
+    JobTable completed_jobs_shared;
     
     std::mutex queue_mutex;
     std::condition_variable job_available;
     std::atomic<bool> simulation_running(true);
-    std::atomic<float> current_time(simulation_start);
 
     // Create and start worker pool
     std::atomic<size_t> context_switch_counter(0);
-    WorkerPool worker_pool(num_cores, policy, ready_queue, 
+    WorkerPool worker_pool(num_cores, policy, *ready_queue, 
                           queue_mutex, job_available, simulation_running,
-                          completed_jobs_shared, completed_mutex, context_switch_counter);
+                          completed_jobs_shared, context_switch_counter,
+                          config_.queue_mode,
+                          createPlacementPolicy(config_.placement, config_.topology));
+    worker_pool.setTraceWriter(trace_);
+    worker_pool.setCostModel(config_.cost);
+    worker_pool.setTopology(config_.topology);
+    worker_pool.setLockProfiling(config_.profile_locks);
+    worker_pool.setExecution(config_.execution);
+    worker_pool.setLiveMetrics(config_.live);
+    worker_pool.setDeterministic(config_.deterministic && config_.queue_mode == QueueMode::GLOBAL);
+    worker_pool.setDispatchLog(config_.dispatch_log);
+    worker_pool.setAdmission(admission);
+    worker_pool.reserveCompletions(jobs.size());
+    const bool has_io = std::any_of(jobs.begin(), jobs.end(),
+                                    [](const Job& job) { return job.hasIoBursts(); });
+    if (has_io) {
+        worker_pool.enableIo(config_.io_depth);
+    }
     worker_pool.start();
+    const std::uint64_t wall_start = CycleClock::now();
 
     // Start scheduler thread
     std::thread scheduler(&SchedulerEngine::schedulerThread, this,
-                         std::move(jobs), std::ref(policy),
-                         std::ref(ready_queue), std::ref(queue_mutex),
-                         std::ref(job_available), std::ref(simulation_running),
+                         std::move(jobs), std::ref(simulation_running),
                          std::ref(result), std::ref(worker_pool));
 
     // Wait for scheduler to finish
@@ -71,93 +194,110 @@ ScheduleResult SchedulerEngine::run(std::vector<Job> jobs, ISchedulingPolicy& po
 
     // Stop worker threads
     simulation_running.store(false);
-    job_available.notify_all();
+    worker_pool.notifyAll();
     worker_pool.stop();
+    result.execution = worker_pool.executionStats();
+    result.execution.wall_time = CycleClock::toSeconds(CycleClock::now() - wall_start);
+    result.stolen_jobs = worker_pool.stolenJobs();
+    result.queue_locks = worker_pool.lockStats();
+    result.preemptions = worker_pool.preemptions();
+    const CostTotals costs = worker_pool.costTotals();
+    result.migrations = costs.migrations;
+    result.remote_migrations = costs.remote_migrations;
+    result.switch_overhead_time = static_cast<float>(costs.switch_overhead);
+    result.warmup_time = static_cast<float>(costs.warmup);
+    const IoDevice& device = worker_pool.ioDevice();
+    result.io_depth = device.depth();
+    result.io_requests = device.requests();
+    result.io_wait_time = static_cast<float>(device.waitTime());
+    result.io_queue_time = static_cast<float>(device.queueTime());
+    result.device_busy_time = static_cast<float>(device.busyTime());
 
-    // Collect completed jobs from shared storage
-    {
-        std::lock_guard<std::mutex> lock(completed_mutex);
-        result.completed_jobs = std::move(completed_jobs_shared);
-    }
-    
-    // Collect any remaining completed jobs from ready queue
-    {
-        std::lock_guard<std::mutex> lock(queue_mutex);
-        collectCompletedJobs(ready_queue, result.completed_jobs, queue_mutex);
-    }
+    result.completed_jobs = std::move(completed_jobs_shared);
 
-    // Calculate final metrics from actual job completion times
-    float earliest_start = simulation_start;
-    float latest_finish = simulation_start;
-    
-    for (const auto& job : result.completed_jobs) {
-        result.total_waiting_time += job.getWaitingTime();
-        result.total_turnaround_time += job.getTurnaroundTime();
-        result.cpu_active_time += job.getBurstTime();
-        
-        if (job.getStartTime() >= 0.0f && (earliest_start == simulation_start || job.getStartTime() < earliest_start)) {
-            earliest_start = job.getStartTime();
-        }
-        if (job.getFinishTime() > latest_finish) {
-            latest_finish = job.getFinishTime();
-        }
+    result.context_switches = context_switch_counter.load();
+}
+
+void SchedulerEngine::aggregateMetrics(ScheduleResult& result, double simulation_start) const {
+    // Column reductions over the completed job table
+    const JobTable& jobs = result.completed_jobs;
+    result.total_waiting_time = static_cast<float>(jobs.totalWaitingTime());
+    result.total_turnaround_time = static_cast<float>(jobs.totalTurnaroundTime());
+    result.cpu_active_time = static_cast<float>(jobs.totalBurstTime());
+    if (result.energy.enabled) {
+        // Bursts are work at full speed; slower cores take longer to run them
+        result.cpu_active_time = static_cast<float>(result.energy.run_time);
     }
-    
+
     // Makespan = time from first job start to last job finish
-    result.makespan = latest_finish - earliest_start;
+    const double earliest_start = jobs.empty() ? simulation_start : jobs.earliestStart();
+    const double latest_finish = jobs.empty() ? simulation_start
+                                              : std::max(simulation_start, jobs.latestFinish());
+    result.makespan = static_cast<float>(latest_finish - earliest_start);
     if (result.makespan < EPSILON) {
         result.makespan = 0.0f;
     }
     
-    result.num_cores = num_cores;
-    
-    result.context_switches = context_switch_counter.load();
-    result.dispatch_count = result.completed_jobs.size();
+    result.dispatch_count = jobs.size();
 
-    printSummary(result, policy);
-    return result;
+    // Jobs without a deadline count as on time. A rejected job with one
+    // missed it: shedding load must not make the miss rate look better.
+    result.deadline_jobs = jobs.deadlineJobs() + result.admission.rejected_deadlines;
+    result.deadline_misses = jobs.deadlineMisses() + result.admission.rejected_deadlines;
+    if (result.makespan > 0.0f) {
+        result.goodput = static_cast<float>(jobs.size() - jobs.deadlineMisses()) / result.makespan;
+    }
+
+    for (std::size_t row = 0; row < jobs.size(); ++row) {
+        result.latency.record(jobs.arrivalTime(row), jobs.burstTime(row),
+                              jobs.startTime(row), jobs.finishTime(row));
+    }
 }
 
-void SchedulerEngine::schedulerThread(std::vector<Job> jobs, ISchedulingPolicy& policy,
-                                     std::vector<Job>& ready_queue,
-                                     std::mutex& queue_mutex,
-                                     std::condition_variable& job_available,
+void SchedulerEngine::schedulerThread(std::vector<Job> jobs,
                                      std::atomic<bool>& simulation_running,
                                      ScheduleResult& result,
                                      WorkerPool& worker_pool) {
-    std::deque<Job> pending;
-    pending.insert(pending.end(),
-                   std::make_move_iterator(jobs.begin()),
-                   std::make_move_iterator(jobs.end()));
+    // Deterministic mode: arrivals take turns with the cores instead
+    if (worker_pool.isDeterministic()) {
+        worker_pool.admitInTurns(jobs);
+        simulation_running.store(false);
+        worker_pool.notifyAll();
+        return;
+    }
 
-    float current_time = jobs.empty() ? 0.0f : jobs.front().getArrivalTime();
-    const float simulation_start = current_time;
+    // Jobs are admitted straight out of the (arrival-sorted) vector
+    std::size_t next = 0;
+    double current_time = jobs.empty() ? 0.0 : jobs.front().getArrivalTime();
 
     while (true) {
-        // Admit newly arrived jobs to ready queue
-        {
-            std::lock_guard<std::mutex> lock(queue_mutex);
-            while (!pending.empty() && pending.front().getArrivalTime() <= current_time + EPSILON) {
-                Job job = std::move(pending.front());
-                pending.pop_front();
-                job.setState(JobState::READY);
-                ready_queue.push_back(std::move(job));
-                job_available.notify_one(); // Notify worker threads
-            }
+        // Admit newly arrived jobs to the worker pool's ready queue(s), as
+        // one batch so a burst fills idle cores under a single queue lock
+        const std::size_t first = next;
+        while (next < jobs.size() && jobs[next].getArrivalTime() <= current_time + EPSILON) {
+            jobs[next++].setState(JobState::READY);
+        }
+        if (next > first) {
+            worker_pool.submitBatch(jobs, first, next);
         }
 
-        {
-            std::lock_guard<std::mutex> lock(queue_mutex);
-            if (pending.empty() && ready_queue.empty() && worker_pool.allIdle()) {
-                break;
-            }
+        // Done once every admitted job has finished (queued or running jobs
+        // are both counted, so a job between slices cannot be missed)
+        const bool pending = next < jobs.size();
+        if (!pending && worker_pool.outstandingJobs() == 0) {
+            break;
+        }
+        const std::size_t queued = worker_pool.queuedJobs();
+        const bool ready_empty = queued == 0;
+        if (config_.live) {
+            config_.live->setQueueDepth(queued);
         }
 
         // Advance time if no jobs are ready
-        if (ready_queue.empty() && !pending.empty()) {
-            const float next_arrival = pending.front().getArrivalTime();
+        if (ready_empty && pending) {
+            const double next_arrival = jobs[next].getArrivalTime();
             if (next_arrival > current_time) {
-                result.idle_time += next_arrival - current_time;
+                result.idle_time += static_cast<float>(next_arrival - current_time);
                 current_time = next_arrival;
             }
         }
@@ -168,22 +308,33 @@ void SchedulerEngine::schedulerThread(std::vector<Job> jobs, ISchedulingPolicy&
 
     // Mark simulation as complete
     simulation_running.store(false);
-    job_available.notify_all();
+    worker_pool.notifyAll();
 }
 
-void SchedulerEngine::collectCompletedJobs(std::vector<Job>& ready_queue,
-                                          std::vector<Job>& completed_jobs,
-                                          std::mutex& queue_mutex) {
-    // Separate completed jobs from ready jobs
-    std::vector<Job> still_ready;
-    for (auto& job : ready_queue) {
-        if (job.getState() == JobState::FINISHED) {
-            completed_jobs.push_back(std::move(job));
-        } else {
-            still_ready.push_back(std::move(job));
-        }
-    }
-    ready_queue = std::move(still_ready);
+void SchedulerEngine::printExecution(const ScheduleResult& result) const {
+    // Simulated times become wall times through the time scale; the
+    // simulator's prediction for the run is makespan x scale
+    const ExecutionStats& stats = result.execution;
+    const double scale = config_.execution.time_scale;
+    const double predicted = static_cast<double>(result.makespan) * scale;
+    const double jobs = static_cast<double>(result.completed_jobs.size());
+
+    std::cout << "Real Execution: " << CpuKernel::modeToString(config_.execution.mode)
+              << " kernel, " << stats.pinned_cores << "/" << result.num_cores
+              << " cores pinned, " << CycleClock::source() << " timestamps\n";
+    std::cout << "Kernel Time: " << std::setprecision(3) << stats.measured_time << " s measured vs "
+              << stats.planned_time << " s calibrated (" << std::setprecision(2)
+              << stats.slowdown() << "x) | Slice Overrun p50/p99: "
+              << stats.overrun.percentile(50.0) * 1e6 << " / "
+              << stats.overrun.percentile(99.0) * 1e6 << " us\n";
+    std::cout << "Wall Time: " << std::setprecision(3) << stats.wall_time << " s measured vs "
+              << predicted << " s predicted | Throughput: " << std::setprecision(2)
+              << (stats.wall_time > 0.0 ? jobs / stats.wall_time : 0.0) << " vs "
+              << (predicted > 0.0 ? jobs / predicted : 0.0) << " jobs/s\n";
+    std::cout << "Dispatch Cost: " << stats.meanDispatchTime() * 1e6
+              << " us per slice (--switch-cost " << std::setprecision(6)
+              << stats.meanDispatchTime() / scale << " to model it)\n";
+    std::cout << std::setprecision(2);
 }
 
 void SchedulerEngine::printSummary(const ScheduleResult& result, const ISchedulingPolicy& policy) const {
@@ -196,34 +347,132 @@ void SchedulerEngine::printSummary(const ScheduleResult& result, const IScheduli
         std::cout << " (Quantum = " << slice << ")";
     }
     std::cout << "\n";
-    std::cout << "------------------------------------------------\n";
-    std::cout << "Job | Arrival | Burst | Start | Finish | Wait | Turnaround\n";
-    std::cout << "------------------------------------------------\n";
-    printJobTable(result.completed_jobs);
-    std::cout << "------------------------------------------------\n";
+    if (result.completed_jobs.size() <= config_.job_table_rows) {
+        std::cout << "------------------------------------------------\n";
+        std::cout << "Job | Arrival | Burst | Start | Finish | Wait | Turnaround\n";
+        std::cout << "------------------------------------------------\n";
+        printJobTable(result.completed_jobs);
+        std::cout << "------------------------------------------------\n";
+    } else {
+        std::cout << "Completed Jobs: " << result.completed_jobs.size()
+                  << " (--job-table prints each one)\n";
+    }
 
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "Average Waiting Time: " << result.averageWaitingTime() << "\n";
     std::cout << "Average Turnaround Time: " << result.averageTurnaroundTime() << "\n";
     std::cout << "CPU Utilization: " << result.cpuUtilization() * 100.0f << "%\n";
     std::cout << "Context Switches: " << result.contextSwitches() << "\n";
+    std::cout << "Turnaround p50/p99/p99.9: " << result.latency.turnaround.percentile(50.0)
+              << " / " << result.latency.turnaround.percentile(99.0)
+              << " / " << result.latency.turnaround.percentile(99.9) << "\n";
+    std::cout << "Response p50/p99/p99.9: " << result.latency.response.percentile(50.0)
+              << " / " << result.latency.response.percentile(99.0)
+              << " / " << result.latency.response.percentile(99.9) << "\n";
+    if (result.num_cores > 1) {
+        std::cout << "Migrations: " << result.migrations;
+        if (config_.topology.sockets > 1) {
+            std::cout << " (" << result.remote_migrations << " cross-socket)";
+        }
+        std::cout << "\n";
+    }
+    if (config_.cost.enabled()) {
+        std::cout << "Switch Overhead: " << result.switch_overhead_time
+                  << " | Cache Warm-up: " << result.warmup_time << "\n";
+    }
+    if (policy.preemptsOnArrival()) {
+        // Every preemption costs one extra dispatch of the preempted job
+        const double share = result.context_switches == 0
+                                 ? 0.0
+                                 : 100.0 * static_cast<double>(result.preemptions) /
+                                       static_cast<double>(result.context_switches);
+        std::cout << "Preemptions: " << result.preemptions << " (" << share
+                  << "% of context switches)\n";
+    }
+    if (result.io_requests > 0) {
+        const float per_job = result.io_wait_time / static_cast<float>(result.completed_jobs.size());
+        std::cout << "I/O Wait: " << result.io_wait_time << " (" << per_job << " per job, "
+                  << result.io_queue_time << " queued) | Device Utilization: "
+                  << result.deviceUtilization() * 100.0f << "% (depth " << result.io_depth
+                  << ")\n";
+    }
+    if (result.deadline_jobs > 0) {
+        std::cout << "Deadlines: met " << result.deadline_jobs - result.deadline_misses << " of "
+                  << result.deadline_jobs << " (" << result.deadlineMissRate() * 100.0f
+                  << "% missed";
+        if (result.admission.rejected_deadlines > 0) {
+            std::cout << ", " << result.admission.rejected_deadlines << " of them rejected";
+        }
+        std::cout << ") | Goodput: " << result.goodput << " jobs/s\n";
+    }
+    if (config_.admission.enabled()) {
+        std::cout << "Admission (" << admissionToString(config_.admission) << "): "
+                  << result.admission.arrivals << " arrivals | " << result.admission.rejected
+                  << " rejected | " << result.admission.downgraded << " downgraded\n";
+    }
+    if (result.energy.enabled) {
+        printEnergy(result);
+    }
+    printTenants(result);
+    if (config_.mode == EngineMode::THREADED && config_.queue_mode == QueueMode::PER_CORE) {
+        std::cout << "Stolen Jobs: " << result.stolen_jobs << "\n";
+    }
+    if (config_.mode == EngineMode::THREADED && config_.execution.real()) {
+        printExecution(result);
+    }
 
     std::cout.flags(original_flags);
     std::cout.precision(original_precision);
 }
 
-void SchedulerEngine::printJobTable(const std::vector<Job>& jobs) const {
-    std::vector<const Job*> ordered;
-    ordered.reserve(jobs.size());
-    for (const auto& job : jobs) {
-        ordered.push_back(&job);
+void SchedulerEngine::printEnergy(const ScheduleResult& result) const {
+    const EnergyStats& energy = result.energy;
+    std::cout << "Energy: " << energy.joules() << " J (" << energy.active_joules << " active, "
+              << energy.idle_joules << " idle) | Average Power: " << energy.averagePower()
+              << " W | Perf/W: " << std::setprecision(4) << result.perfPerWatt()
+              << std::setprecision(2) << " jobs/J\n";
+    std::vector<CoreType> cores;
+    for (int core_id = 0; core_id < result.num_cores; ++core_id) {
+        cores.push_back(config_.power.coreType(core_id));
+    }
+    std::cout << "Cores: " << coreTypesToString(cores) << " | Placement: "
+              << energyPlacementToString(config_.power.placement) << "\n";
+    if (config_.power.frequencies.size() > 1) {
+        std::cout << "DVFS (" << governorToString(config_.power.governor) << ", "
+                  << config_.power.frequencies.size() << " levels): " << energy.transitions
+                  << " transitions | " << energy.transition_time << " s stalled\n";
+    }
+}
+
+void SchedulerEngine::printTenants(const ScheduleResult& result) const {
+    const std::vector<TenantMetrics> tenants =
+        MetricsCollector::tenantBreakdown(result.completed_jobs, result.makespan);
+    if (tenants.size() < 2) {
+        return;
+    }
+
+    const double total_cpu = result.completed_jobs.totalBurstTime();
+    for (const TenantMetrics& tenant : tenants) {
+        const double share = total_cpu > 0.0 ? 100.0 * tenant.cpu_time / total_cpu : 0.0;
+        std::cout << "Tenant " << tenant.tenant << ": " << tenant.jobs << " jobs | "
+                  << tenant.throughput << " jobs/s | Avg Wait " << tenant.averageWaitingTime()
+                  << " | Turnaround p50/p99 " << tenant.latency.turnaround.percentile(50.0)
+                  << " / " << tenant.latency.turnaround.percentile(99.0) << " | CPU " << share
+                  << "%\n";
+    }
+}
+
+void SchedulerEngine::printJobTable(const JobTable& jobs) const {
+    std::vector<std::size_t> ordered(jobs.size());
+    for (std::size_t row = 0; row < ordered.size(); ++row) {
+        ordered[row] = row;
     }
 
     std::sort(ordered.begin(), ordered.end(),
-              [](const Job* lhs, const Job* rhs) { return lhs->getId() < rhs->getId(); });
+              [&jobs](std::size_t lhs, std::size_t rhs) { return jobs.id(lhs) < jobs.id(rhs); });
 
-    for (const Job* job : ordered) {
-        job->printTableRow();
+    for (std::size_t row : ordered) {
+        jobs.toJob(row).printTableRow();
     }
 }
 
@@ -1,4 +1,5 @@
 #include "sjf_policy.h"
+#include "heap_ready_queue.h"
 #include <algorithm>
 
 namespace chronos {
@@ -9,21 +10,13 @@ Job* SJFPolicy::getNextJob(std::vector<Job>& ready_queue) {
     }
 
     // Shortest burst first --> tie-break on arrival time, then job id.
-    auto it = std::min_element(
-        ready_queue.begin(),
-        ready_queue.end(),
-        [](const Job& a, const Job& b) {
-            if (a.getBurstTime() != b.getBurstTime()) {
-                return a.getBurstTime() < b.getBurstTime();
-            }
-            if (a.getArrivalTime() != b.getArrivalTime()) {
-                return a.getArrivalTime() < b.getArrivalTime();
-            }
-            return a.getId() < b.getId();
-        }
-    );
+    auto it = std::min_element(ready_queue.begin(), ready_queue.end(), SJFOrder{});
 
     return (it != ready_queue.end()) ? &(*it) : nullptr;
 }
 
+std::unique_ptr<ReadyQueue> SJFPolicy::createReadyQueue() {
+    return std::make_unique<HeapReadyQueue<SJFOrder>>();
+}
+
 } 
\ No newline at end of file
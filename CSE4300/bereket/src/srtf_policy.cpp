@@ -0,0 +1,21 @@
+#include "srtf_policy.h"
+#include "heap_ready_queue.h"
+#include <algorithm>
+
+namespace chronos {
+
+Job* SRTFPolicy::getNextJob(std::vector<Job>& ready_queue) {
+    if (ready_queue.empty()) {
+        return nullptr;
+    }
+
+    auto it = std::min_element(ready_queue.begin(), ready_queue.end(), SRTFOrder{});
+
+    return (it != ready_queue.end()) ? &(*it) : nullptr;
+}
+
+std::unique_ptr<ReadyQueue> SRTFPolicy::createReadyQueue() {
+    return std::make_unique<HeapReadyQueue<SRTFOrder>>();
+}
+
+}
@@ -0,0 +1,195 @@
+#include "trace_writer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace chronos {
+namespace {
+constexpr std::size_t BUFFER_RECORDS = 64 * 1024;          // 1.5 MB per write
+constexpr std::size_t INITIAL_MAP_RECORDS = 1024 * 1024;   // 24 MB, doubled as needed
+} // namespace
+
+TraceWriter::TraceWriter() = default;
+
+TraceWriter::~TraceWriter() {
+    close();
+}
+
+bool TraceWriter::open(const std::string& path, const std::string& algorithm, bool use_mmap) {
+    close();
+    path_ = path;
+    algorithm_ = algorithm;
+    record_count_ = 0;
+    failed_ = false;
+
+#ifndef _WIN32
+    if (use_mmap) {
+        map_fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (map_fd_ < 0) {
+            std::cerr << "Error: Could not open trace file for writing: " << path << "\n";
+            return false;
+        }
+        if (!growMapping()) {
+            ::close(map_fd_);
+            map_fd_ = -1;
+            return false;
+        }
+        return true;
+    }
+#else
+    if (use_mmap) {
+        std::cerr << "Warning: Memory-mapped traces are not supported on this platform; "
+                  << "using buffered writes\n";
+    }
+#endif
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        std::cerr << "Error: Could not open trace file for writing: " << path << "\n";
+        return false;
+    }
+
+    // Placeholder header; the record count is patched in by close()
+    TraceHeader header;
+    fillHeader(header);
+    if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+        std::cerr << "Error: Failed to write trace header: " << path << "\n";
+        std::fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+
+    buffer_.resize(BUFFER_RECORDS);
+    buffer_used_ = 0;
+    return true;
+}
+
+TraceRecord* TraceWriter::acquireSlot() {
+    if (failed_) {
+        return nullptr;
+    }
+
+    if (file_) {
+        if (!flushBuffer()) {
+            return nullptr;
+        }
+        return &buffer_[buffer_used_++];
+    }
+
+    if (map_fd_ >= 0 && growMapping()) {
+        return &map_base_[map_used_++];
+    }
+    return nullptr;
+}
+
+bool TraceWriter::flushBuffer() {
+    if (buffer_used_ == 0) {
+        return true;
+    }
+
+    if (std::fwrite(buffer_.data(), sizeof(TraceRecord), buffer_used_, file_) != buffer_used_) {
+        std::cerr << "Error: Failed to write to trace file: " << path_ << "\n";
+        failed_ = true;
+        return false;
+    }
+    buffer_used_ = 0;
+    return true;
+}
+
+bool TraceWriter::growMapping() {
+#ifndef _WIN32
+    const std::size_t new_capacity = map_capacity_ == 0 ? INITIAL_MAP_RECORDS : map_capacity_ * 2;
+    const std::size_t new_length = sizeof(TraceHeader) + new_capacity * sizeof(TraceRecord);
+
+    if (map_addr_) {
+        ::munmap(map_addr_, map_length_);
+        map_addr_ = nullptr;
+        map_base_ = nullptr;
+    }
+
+    if (::ftruncate(map_fd_, static_cast<off_t>(new_length)) != 0) {
+        std::cerr << "Error: Could not grow trace file: " << path_ << "\n";
+        failed_ = true;
+        return false;
+    }
+
+    void* addr = ::mmap(nullptr, new_length, PROT_READ | PROT_WRITE, MAP_SHARED, map_fd_, 0);
+    if (addr == MAP_FAILED) {
+        std::cerr << "Error: Could not memory-map trace file: " << path_ << "\n";
+        failed_ = true;
+        return false;
+    }
+
+    map_addr_ = addr;
+    map_length_ = new_length;
+    map_capacity_ = new_capacity;
+    map_base_ = reinterpret_cast<TraceRecord*>(static_cast<char*>(addr) + sizeof(TraceHeader));
+    return true;
+#else
+    return false;
+#endif
+}
+
+void TraceWriter::fillHeader(TraceHeader& header) const {
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "CHRTRACE", sizeof(header.magic));
+    header.version = VERSION;
+    header.record_size = sizeof(TraceRecord);
+    header.record_count = record_count_;
+    std::strncpy(header.algorithm, algorithm_.c_str(), sizeof(header.algorithm) - 1);
+}
+
+bool TraceWriter::close() {
+    bool ok = !failed_;
+    TraceHeader header;
+
+    if (file_) {
+        ok = flushBuffer() && ok;
+        fillHeader(header);
+        if (std::fseek(file_, 0, SEEK_SET) != 0 ||
+            std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+            std::cerr << "Error: Failed to finalize trace header: " << path_ << "\n";
+            ok = false;
+        }
+        if (std::fclose(file_) != 0) {
+            ok = false;
+        }
+        file_ = nullptr;
+        buffer_.clear();
+        buffer_.shrink_to_fit();
+        buffer_used_ = 0;
+    }
+
+#ifndef _WIN32
+    if (map_fd_ >= 0) {
+        if (map_addr_) {
+            fillHeader(header);
+            std::memcpy(map_addr_, &header, sizeof(header));
+            ::munmap(map_addr_, map_length_);
+        }
+        // Drop the unused tail of the last mapping
+        const std::size_t used_length = sizeof(TraceHeader) + map_used_ * sizeof(TraceRecord);
+        if (::ftruncate(map_fd_, static_cast<off_t>(used_length)) != 0) {
+            ok = false;
+        }
+        ::close(map_fd_);
+        map_fd_ = -1;
+        map_addr_ = nullptr;
+        map_base_ = nullptr;
+        map_length_ = 0;
+        map_capacity_ = 0;
+        map_used_ = 0;
+    }
+#endif
+
+    return ok;
+}
+
+}
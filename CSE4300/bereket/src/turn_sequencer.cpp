@@ -0,0 +1,78 @@
+#include "turn_sequencer.h"
+
+namespace chronos {
+
+TurnSequencer::TurnSequencer(int actors) {
+    actors_.reserve(static_cast<std::size_t>(actors));
+    for (int i = 0; i < actors; ++i) {
+        actors_.push_back(std::make_unique<Actor>());
+    }
+}
+
+void TurnSequencer::schedule(int actor, double time, Phase phase) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Actor& target = *actors_[static_cast<std::size_t>(actor)];
+    target.time = time;
+    target.phase = phase;
+}
+
+void TurnSequencer::begin() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    advance();
+}
+
+bool TurnSequencer::wait(int actor) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    actors_[static_cast<std::size_t>(actor)]->turn.wait(
+        lock, [this, actor] { return current_ == actor || finished_; });
+    return current_ == actor;
+}
+
+void TurnSequencer::pass(int actor, double time, Phase phase) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Actor& holder = *actors_[static_cast<std::size_t>(actor)];
+    holder.time = time;
+    holder.phase = phase;
+    advance();
+}
+
+double TurnSequencer::now() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return now_;
+}
+
+int TurnSequencer::next() const {
+    int best = -1;
+    for (int i = 0; i < static_cast<int>(actors_.size()); ++i) {
+        const Actor& actor = *actors_[static_cast<std::size_t>(i)];
+        if (actor.time == IDLE) {
+            continue;
+        }
+        // Ties on time go to the earlier phase, then the lower actor index
+        if (best < 0) {
+            best = i;
+            continue;
+        }
+        const Actor& current = *actors_[static_cast<std::size_t>(best)];
+        if (actor.time < current.time ||
+            (actor.time == current.time && actor.phase < current.phase)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+void TurnSequencer::advance() {
+    current_ = next();
+    if (current_ < 0) {
+        finished_ = true;
+        for (auto& actor : actors_) {
+            actor->turn.notify_all();
+        }
+        return;
+    }
+    now_ = actors_[static_cast<std::size_t>(current_)]->time;
+    actors_[static_cast<std::size_t>(current_)]->turn.notify_one();
+}
+
+}
@@ -1,18 +1,67 @@
 #include "worker_pool.h"
+#include "cycle_clock.h"
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
+#include <queue>
 #include <iostream>
 
 namespace chronos {
+namespace {
+// How long an idle core sleeps before checking its peers for work to steal.
+// Arrivals wake the target core directly; stealing is only needed to rebalance.
+constexpr auto STEAL_RETRY_INTERVAL = std::chrono::milliseconds(1);
+constexpr float MIN_SLICE = 0.001f;
+
+// unique_lock that charges the time it is held to a LockStats, if one is given
+class ProfiledLock {
+public:
+    ProfiledLock(std::mutex& mutex, LockStats* stats)
+        : lock_(mutex)
+        , stats_(stats)
+    {
+        restart();
+    }
+
+    ~ProfiledLock() { unlock(); }
+
+    // For condition variable waits; call restart() once the wait returns
+    std::unique_lock<std::mutex>& get() { return lock_; }
+
+    void restart() {
+        if (stats_) {
+            acquired_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    void unlock() {
+        if (!lock_.owns_lock()) {
+            return;
+        }
+        if (stats_) {
+            stats_->record(std::chrono::duration<double, std::nano>(
+                               std::chrono::steady_clock::now() - acquired_).count());
+        }
+        lock_.unlock();
+    }
+
+private:
+    std::unique_lock<std::mutex> lock_;
+    LockStats* stats_;
+    std::chrono::steady_clock::time_point acquired_;
+};
+} // namespace
 
 WorkerPool::WorkerPool(int num_cores, ISchedulingPolicy& policy,
-                       std::vector<Job>& ready_queue,
+                       ReadyQueue& ready_queue,
                        std::mutex& queue_mutex,
                        std::condition_variable& job_available,
                        std::atomic<bool>& simulation_running,
-                       std::vector<Job>& completed_jobs,
-                       std::mutex& completed_mutex,
-                       std::atomic<size_t>& context_switches)
+                       JobTable& completed_jobs,
+                       std::atomic<size_t>& context_switches,
+                       QueueMode queue_mode,
+                       std::unique_ptr<PlacementPolicy> placement)
     : num_cores_(num_cores)
     , policy_(policy)
     , ready_queue_(ready_queue)
@@ -20,25 +69,96 @@ WorkerPool::WorkerPool(int num_cores, ISchedulingPolicy& policy,
     , job_available_(job_available)
     , simulation_running_(simulation_running)
     , completed_jobs_(completed_jobs)
-    , completed_mutex_(completed_mutex)
     , context_switches_(context_switches)
+    , queue_mode_(queue_mode)
+    , placement_(std::move(placement))
     , active_workers_(0)
+    , queued_jobs_(0)
+    , outstanding_jobs_(0)
+    , stolen_jobs_(0)
+    , preemptions_(0)
+    , locals_(static_cast<std::size_t>(num_cores))
     , executing_jobs_(num_cores)
 {
     for (int i = 0; i < num_cores_; ++i) {
         executing_jobs_[i].store(nullptr);
     }
+
+    if (queue_mode_ == QueueMode::GLOBAL) {
+        handoffs_.reserve(num_cores_);
+        for (int i = 0; i < num_cores_; ++i) {
+            handoffs_.push_back(std::make_unique<Handoff>());
+        }
+        parked_.reserve(num_cores_);
+        batch_.reserve(num_cores_);
+    }
+
+    if (queue_mode_ == QueueMode::PER_CORE) {
+        if (!placement_) {
+            placement_ = createPlacementPolicy(PlacementStrategy::ROUND_ROBIN);
+        }
+        run_queues_.reserve(num_cores_);
+        for (int i = 0; i < num_cores_; ++i) {
+            auto run_queue = std::make_unique<RunQueue>();
+            run_queue->queue = policy_.createReadyQueue();
+            run_queues_.push_back(std::move(run_queue));
+        }
+        load_snapshot_.resize(num_cores_, 0);
+        io_lengths_.resize(num_cores_, 0);
+        for (auto& local : locals_) {
+            local.queue_lengths.resize(num_cores_, 0);
+        }
+    }
+
+    if (policy_.preemptsOnArrival()) {
+        slots_.reserve(num_cores_);
+        for (int i = 0; i < num_cores_; ++i) {
+            slots_.push_back(std::make_unique<CoreSlot>());
+        }
+    }
 }
 
 WorkerPool::~WorkerPool() {
     stop();
 }
 
+void WorkerPool::reserveCompletions(std::size_t jobs) {
+    // Cores rarely finish exactly even shares: leave an eighth of slack
+    const std::size_t share = jobs / static_cast<std::size_t>(num_cores_) + 1;
+    for (auto& local : locals_) {
+        local.completed.reserve(share + share / 8);
+    }
+}
+
+void WorkerPool::enableIo(int depth) {
+    io_enabled_ = true;
+    device_ = IoDevice(depth);
+}
+
 void WorkerPool::start() {
+    if (execution_.real()) {
+        // Single-thread rate, measured before the workers start competing
+        CpuKernel probe(execution_.mode, execution_.working_set);
+        units_per_second_ = probe.calibrate();
+    }
+    if (deterministic_ && queue_mode_ == QueueMode::GLOBAL) {
+        // Every core starts parked, core 0 first in line for work; the
+        // arrivals take the first turn
+        turns_ = std::make_unique<TurnSequencer>(num_cores_ + 2);
+        for (int core = num_cores_ - 1; core >= 0; --core) {
+            parked_.push_back(core);
+        }
+        blocked_order_.simulated = true;
+        turns_->schedule(arrivalActor(), 0.0f, TurnSequencer::Phase::RELEASE);
+        turns_->begin();
+    }
     workers_.reserve(num_cores_);
     for (int i = 0; i < num_cores_; ++i) {
         workers_.emplace_back(&WorkerPool::workerThread, this, i);
     }
+    if (io_enabled_) {
+        io_thread_ = std::thread(&WorkerPool::ioThread, this);
+    }
 }
 
 void WorkerPool::stop() {
@@ -47,68 +167,321 @@ void WorkerPool::stop() {
             worker.join();
         }
     }
-    workers_.clear();
+    if (io_thread_.joinable()) {
+        io_thread_.join();
+    }
+    if (!workers_.empty()) {
+        workers_.clear();
+        mergeCompleted();
+    }
+}
+
+void WorkerPool::mergeCompleted() {
+    std::size_t total = 0;
+    std::size_t dispatches = 0;
+    for (auto& local : locals_) {
+        total += local.completed.size();
+        dispatches += local.dispatches;
+        local.dispatches = 0;
+    }
+    context_switches_.fetch_add(dispatches);
+    completed_jobs_.reserve(completed_jobs_.size() + total);
+
+    // Each buffer is already ordered by its core's clock: k-way merge on
+    // (finish time, core) gives one deterministic completion order
+    using Cursor = std::pair<double, std::size_t>;
+    std::priority_queue<Cursor, std::vector<Cursor>, std::greater<Cursor>> heads;
+    std::vector<std::size_t> next_row(locals_.size(), 0);
+    for (std::size_t core = 0; core < locals_.size(); ++core) {
+        if (!locals_[core].completed.empty()) {
+            heads.emplace(locals_[core].completed.finishTime(0), core);
+        }
+    }
+    while (!heads.empty()) {
+        const std::size_t core = heads.top().second;
+        heads.pop();
+        const JobTable& source = locals_[core].completed;
+        completed_jobs_.appendRow(source, next_row[core]++);
+        if (next_row[core] < source.size()) {
+            heads.emplace(source.finishTime(next_row[core]), core);
+        }
+    }
+
+    for (auto& local : locals_) {
+        local.completed.clear();
+    }
+}
+
+LockStats WorkerPool::lockStats() const {
+    LockStats stats;
+    for (const auto& local : locals_) {
+        stats.merge(local.locks);
+    }
+    return stats;
+}
+
+ExecutionStats WorkerPool::executionStats() const {
+    ExecutionStats stats;
+    for (const auto& local : locals_) {
+        stats.merge(local.execution);
+    }
+    stats.units_per_second = units_per_second_;
+    return stats;
+}
+
+CostTotals WorkerPool::costTotals() const {
+    CostTotals totals;
+    for (const auto& local : locals_) {
+        totals.merge(local.costs);
+    }
+    return totals;
 }
 
 bool WorkerPool::allIdle() const {
     return active_workers_.load() == 0;
 }
 
-void WorkerPool::workerThread(int core_id) {
-    // Each core tracks its own local time (when it will be free)
-    float local_core_time = 0.0f;
-    
-    while (simulation_running_.load() || !ready_queue_.empty()) {
-        std::unique_lock<std::mutex> lock(queue_mutex_);
-        
-        // Wait for jobs to be available or simulation to end
-        job_available_.wait(lock, [this] {
-            return !ready_queue_.empty() || !simulation_running_.load();
-        });
-        
-        // Check if we should exit
-        if (!simulation_running_.load() && ready_queue_.empty()) {
-            break;
+void WorkerPool::submit(Job job) {
+    outstanding_jobs_.fetch_add(1);
+    traceEvent(TraceEventType::ARRIVAL, job.getArrivalTime(), job, -1,
+               job.getBurstTime(), job.getPriority());
+    enqueue(std::move(job), true);
+}
+
+void WorkerPool::submitBatch(std::vector<Job>& jobs, std::size_t first, std::size_t last) {
+    if (admission_) {
+        last = screenArrivals(jobs, first, last);
+        if (last == first) {
+            return;
         }
-        
-        // Get next job from policy
-        Job* selected_job = policy_.getNextJob(ready_queue_);
-        if (!selected_job) {
-            continue;
+    }
+
+    // Preempting arrivals and per-core placement are decided job by job
+    if (queue_mode_ != QueueMode::GLOBAL || !slots_.empty() || last - first < 2) {
+        for (std::size_t i = first; i < last; ++i) {
+            submit(std::move(jobs[i]));
         }
-        
-        // Find job in ready queue and mark as running
-        auto it = std::find_if(ready_queue_.begin(), ready_queue_.end(),
-            [selected_job](const Job& job) {
-                return job.getId() == selected_job->getId();
-            });
-        
-        if (it == ready_queue_.end()) {
+        return;
+    }
+
+    outstanding_jobs_.fetch_add(last - first);
+    for (std::size_t i = first; i < last; ++i) {
+        traceEvent(TraceEventType::ARRIVAL, jobs[i].getArrivalTime(), jobs[i], -1,
+                   jobs[i].getBurstTime(), jobs[i].getPriority());
+    }
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    for (std::size_t i = first; i < last; ++i) {
+        ready_queue_.push(std::move(jobs[i]));
+    }
+    queued_jobs_.fetch_add(last - first);
+    handOffParked();
+}
+
+std::size_t WorkerPool::screenArrivals(std::vector<Job>& jobs, std::size_t first, std::size_t last) {
+    // Admitted jobs are packed to the front of the range, in order
+    std::size_t kept = first;
+    for (std::size_t i = first; i < last; ++i) {
+        const AdmissionView view{queued_jobs_.load() + (kept - first), num_cores_};
+        if (!admission_->admit(jobs[i], view)) {
             continue;
         }
-        
-        //Copy the job before erasing from vector to avoid dangling reference
-        Job job = *it;
-        
-        // Remove job from ready queue to free the slot
-        ready_queue_.erase(it);
-        
-        // Core starts job at max(its current free time, job's arrival time)
-        const float dispatch_time = std::max(local_core_time, job.getArrivalTime());
-        
+        if (kept != i) {
+            jobs[kept] = std::move(jobs[i]);
+        }
+        ++kept;
+    }
+    return kept;
+}
+
+void WorkerPool::admitInTurns(std::vector<Job>& jobs) {
+    std::size_t next = 0;
+    while (turns_->wait(arrivalActor())) {
+        const double now = turns_->now();
+        const std::size_t first = next;
+        while (next < jobs.size() && jobs[next].getArrivalTime() <= now) {
+            jobs[next++].setState(JobState::READY);
+        }
+        if (next > first) {
+            submitBatch(jobs, first, next);
+        }
+        if (live_) {
+            live_->setQueueDepth(queued_jobs_.load());
+        }
+        turns_->pass(arrivalActor(),
+                     next < jobs.size() ? jobs[next].getArrivalTime() : TurnSequencer::IDLE);
+    }
+}
+
+void WorkerPool::handOffParked() {
+    if (parked_.empty() || ready_queue_.empty()) {
+        return;
+    }
+    if (turns_) {
+        // Deterministic mode: parked cores pop for themselves, each in its
+        // own turn at this instant
+        const double now = turns_->now();
+        for (std::size_t woken = std::min(parked_.size(), ready_queue_.size()); woken > 0; --woken) {
+            turns_->schedule(parked_.back(), now, TurnSequencer::Phase::ACQUIRE);
+            parked_.pop_back();
+        }
+        return;
+    }
+    batch_.clear();
+    const std::size_t count = ready_queue_.popBatch(parked_.size(), batch_);
+    queued_jobs_.fetch_sub(count);
+    active_workers_.fetch_add(static_cast<int>(count));
+
+    // Most recently parked core first: its cache is the warmest
+    for (Job& job : batch_) {
+        Handoff& handoff = *handoffs_[static_cast<std::size_t>(parked_.back())];
+        parked_.pop_back();
+        {
+            std::lock_guard<std::mutex> lock(handoff.mutex);
+            handoff.job = std::move(job);
+            handoff.has_job = true;
+        }
+        handoff.ready.notify_one();
+    }
+}
+
+void WorkerPool::enqueue(Job job, bool arrival) {
+    // The victim is chosen before the job is queued but only interrupted
+    // after, so the preempted worker finds the arrival when it picks again
+    const double ready_time = job.getReadyTime();
+
+    if (queue_mode_ == QueueMode::GLOBAL) {
+        int victim_job_id = -1;
+        const int victim = slots_.empty() ? -1 : choosePreemptionVictim(job, -1, victim_job_id);
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            ready_queue_.push(std::move(job));
+            queued_jobs_.fetch_add(1);
+            handOffParked();
+        }
+        if (victim >= 0) {
+            cutSlice(victim, victim_job_id, ready_time);
+        }
+        return;
+    }
+
+    // Placement only reads the per-core counters, no queue lock is taken.
+    // A job back from I/O is placed like a requeue (by default on its last
+    // core) and may only preempt the core it is placed on, so pinned jobs
+    // stay pinned. A preempting arrival goes to the core it displaced.
+    int core = -1;
+    if (!arrival) {
+        snapshotLengths(io_lengths_);
+        core = placement_->requeueJob(job, io_lengths_);
+        if (core < 0 || core >= num_cores_) {
+            core = 0;
+        }
+    }
+    int victim_job_id = -1;
+    const int victim = slots_.empty() ? -1 : choosePreemptionVictim(job, core, victim_job_id);
+    if (arrival) {
+        core = victim;
+        if (core < 0) {
+            snapshotLengths(load_snapshot_);
+            core = placement_->placeJob(job, load_snapshot_);
+        }
+        if (core < 0 || core >= num_cores_) {
+            core = 0;
+        }
+    }
+
+    RunQueue& target = *run_queues_[core];
+    {
+        std::lock_guard<std::mutex> lock(target.mutex);
+        target.queue->push(std::move(job));
+        target.length.fetch_add(1);
+        queued_jobs_.fetch_add(1);
+    }
+    if (victim >= 0) {
+        cutSlice(victim, victim_job_id, ready_time);
+    }
+    target.job_available.notify_one();
+}
+
+void WorkerPool::notifyAll() {
+    // Taking each lock once orders the wake-up after any in-progress predicate check
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+    }
+    job_available_.notify_all();
+
+    for (auto& handoff : handoffs_) {
+        {
+            std::lock_guard<std::mutex> lock(handoff->mutex);
+        }
+        handoff->ready.notify_all();
+    }
+
+    for (auto& run_queue : run_queues_) {
+        {
+            std::lock_guard<std::mutex> lock(run_queue->mutex);
+        }
+        run_queue->job_available.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(io_mutex_);
+    }
+    io_wakeup_.notify_all();
+}
+
+void WorkerPool::workerThread(int core_id) {
+    // Each core tracks its own local time (when it will be free)
+    double local_core_time = 0.0;
+
+    // Real execution: pin first, so the kernel's working set is allocated
+    // (first touched) on the core's own NUMA node
+    const bool real = execution_.real();
+    if (real) {
+        WorkerLocal& local = locals_[static_cast<std::size_t>(core_id)];
+        if (execution_.pin_threads && CpuKernel::pinCurrentThread(core_id)) {
+            local.execution.pinned_cores = 1;
+        }
+        local.kernel = std::make_unique<CpuKernel>(execution_.mode, execution_.working_set);
+    }
+
+    while (true) {
+        Job job(0, 0.0f, 0.0f);
+        double turn_time = 0.0;
+        const bool acquired = turns_ ? acquireInTurn(core_id, job, turn_time)
+                              : (queue_mode_ == QueueMode::GLOBAL)
+                                  ? acquireGlobalJob(core_id, job)
+                                  : acquireLocalJob(core_id, job);
+        if (!acquired) {
+            break;
+        }
+        const std::uint64_t acquired_at = real ? CycleClock::now() : 0;
+
+        // Core starts job at max(its current free time, when the job became
+        // ready). In deterministic mode that is the time of its turn, which
+        // comes after both.
+        const double dispatch_time =
+            turns_ ? turn_time : std::max(local_core_time, job.getReadyTime());
+
+        // Count this as a context switch (job dispatch to CPU); core-local
+        // until stop() adds the counters up
+        WorkerLocal& local = locals_[static_cast<std::size_t>(core_id)];
+        ++local.dispatches;
+
+        // The core switches (and warms its cache) before the job runs
+        const float overhead =
+            local.costs.charge(cost_, job, core_id, topology_.nodeOf(core_id, num_cores_));
+        const double run_start = dispatch_time + overhead;
+
         // Set start time only once (first execution)
-        if (job.getStartTime() < 0.0f) {
-            job.setStartTime(dispatch_time);
+        const bool first_dispatch = job.getStartTime() < 0.0;
+        if (first_dispatch) {
+            job.setStartTime(run_start);
         }
-        
+
         job.setState(JobState::RUNNING);
-        active_workers_.fetch_add(1);
-        
-        // Count this as a context switch (job dispatch to CPU)
-        context_switches_.fetch_add(1);
-        
+
         // Get execution time slice
-        const float time_slice = policy_.getTimeSlice();
+        const float time_slice = policy_.getTimeSlice(job);
         const float remaining = job.getRemainingTime();
         float execution = remaining;
         if (time_slice > 0.0f) {
@@ -117,56 +490,484 @@ void WorkerPool::workerThread(int core_id) {
         if (execution < 0.001f) {
             execution = remaining;
         }
-        
-        lock.unlock();
-        
+        traceEvent(TraceEventType::DISPATCH, run_start, job, core_id,
+                   execution, first_dispatch ? 1 : 0);
+
+        // Deterministic mode: log and publish the slice before the turn ends,
+        // so arrivals in later turns see it running
+        const float planned = execution;
+        if (turns_) {
+            if (dispatch_log_) {
+                dispatch_log_->record(
+                    DispatchRecord{run_start, job.getId(), core_id, planned, remaining});
+            }
+            if (!slots_.empty()) {
+                armSlot(core_id, job, run_start, planned);
+            }
+            turns_->pass(core_id, run_start + planned, TurnSequencer::Phase::RELEASE);
+        }
+
         // Execute job (simulate CPU execution by sleeping)
-        executeJob(job, execution, core_id);
-        
+        execution = executeJob(job, planned, overhead, run_start, core_id, acquired_at);
+
+        // Deterministic mode: the slice ends in its own turn, however long
+        // the sleep took; a cut made in an earlier turn already moved that
+        // turn up to the cut
+        if (turns_) {
+            turns_->wait(core_id);
+            if (!slots_.empty()) {
+                execution = disarmSlot(core_id, run_start, planned);
+            }
+        }
+        const bool preempted = execution < planned;
+        job.setLastSlice(execution);
+
         // Calculate when this core finishes executing this slice
-        const float finish_time = dispatch_time + execution;
+        const double finish_time = run_start + execution;
         local_core_time = finish_time;
-        
+        if (live_) {
+            live_->recordSlice(core_id, run_start, execution);
+        }
+
         float new_remaining = remaining - execution;
         if (new_remaining < 0.001f) {
             new_remaining = 0.0f;
         }
         job.setRemainingTime(new_remaining);
-        
-        // Re-acquire lock for completion handling
-        lock.lock();
-        
-        if (new_remaining <= 0.001f) {
+
+        if (new_remaining <= 0.001f && job.getPendingIoBurst() > 0.0f) {
+            job.setRemainingTime(0.0f);
+            job.setState(JobState::WAITING);
+        } else if (new_remaining <= 0.001f) {
             job.setRemainingTime(0.0f);
             job.setFinishTime(finish_time);
             job.setState(JobState::FINISHED);
-            job.calculateMetrics();
-            policy_.onJobCompletion(&job, finish_time);
-            
-            // Add to shared completed jobs storage
-            {
-                std::lock_guard<std::mutex> completed_lock(completed_mutex_);
-                completed_jobs_.push_back(job);
+            traceEvent(TraceEventType::COMPLETION, finish_time, job, core_id,
+                       job.getTurnaroundTime());
+            if (live_) {
+                live_->recordCompletion(core_id, job.getTurnaroundTime());
             }
         } else {
             job.setState(JobState::READY);
-            ready_queue_.push_back(job);
-            policy_.onJobCompletion(&job, finish_time);
-            job_available_.notify_one(); // Notify other workers
+            traceEvent(TraceEventType::SLICE_END, finish_time, job, core_id, new_remaining,
+                       preempted ? 1 : 0);
         }
-        
+        if (real) {
+            const std::uint64_t end_start = CycleClock::now();
+            endSlice(core_id, std::move(job), finish_time);
+            local.execution.dispatch_time += CycleClock::toSeconds(CycleClock::now() - end_start);
+        } else {
+            endSlice(core_id, std::move(job), finish_time);
+        }
+
         active_workers_.fetch_sub(1);
+        if (turns_) {
+            turns_->pass(core_id, finish_time, TurnSequencer::Phase::ACQUIRE);
+        }
+    }
+}
+
+void WorkerPool::beginIo(int core_id, Job job, double now) {
+    {
+        std::lock_guard<std::mutex> lock(io_mutex_);
+        const IoDevice::Request request = device_.submit(now, job.getPendingIoBurst());
+        traceEvent(TraceEventType::IO_START, now, job, core_id, job.getPendingIoBurst(),
+                   request.channel);
+
+        // Blocked for as long in wall time as in simulated time (1 s = 1 s,
+        // or the time scale of real execution)
+        const double scale = execution_.real() ? execution_.time_scale : 1.0;
+        const auto blocked_for = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>((request.finish - now) * scale));
+        blocked_.push_back(Blocked{std::chrono::steady_clock::now() + blocked_for, now,
+                                   request.finish, std::move(job)});
+        std::push_heap(blocked_.begin(), blocked_.end(), blocked_order_);
+        if (turns_) {
+            turns_->schedule(ioActor(), blocked_.front().ready_time,
+                             TurnSequencer::Phase::RELEASE);
+        }
+    }
+    io_wakeup_.notify_one();
+}
+
+void WorkerPool::ioThread() {
+    if (turns_) {
+        ioInTurns();
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(io_mutex_);
+    while (true) {
+        // Every blocked job still counts as outstanding, so the simulation
+        // cannot end while one is waiting here
+        io_wakeup_.wait(lock, [this] { return !blocked_.empty() || !simulation_running_.load(); });
+        if (blocked_.empty()) {
+            return;
+        }
+        if (std::chrono::steady_clock::now() < blocked_.front().due) {
+            io_wakeup_.wait_until(lock, blocked_.front().due);
+            continue;   // Woken early by a new request that may be due sooner
+        }
+
+        std::pop_heap(blocked_.begin(), blocked_.end(), blocked_order_);
+        Blocked done = std::move(blocked_.back());
+        blocked_.pop_back();
+        lock.unlock();
+
+        readmit(done);
+        lock.lock();
+    }
+}
+
+void WorkerPool::ioInTurns() {
+    // Each turn comes at the earliest completion, which beginIo() keeps scheduled
+    while (turns_->wait(ioActor())) {
+        Blocked done;
+        {
+            std::lock_guard<std::mutex> lock(io_mutex_);
+            std::pop_heap(blocked_.begin(), blocked_.end(), blocked_order_);
+            done = std::move(blocked_.back());
+            blocked_.pop_back();
+        }
+        readmit(done);
+
+        double next = TurnSequencer::IDLE;
+        {
+            std::lock_guard<std::mutex> lock(io_mutex_);
+            if (!blocked_.empty()) {
+                next = blocked_.front().ready_time;
+            }
+        }
+        turns_->pass(ioActor(), next);
     }
 }
 
-void WorkerPool::executeJob(Job& job, float time_slice, int core_id) {
+void WorkerPool::readmit(Blocked& done) {
+    Job& job = done.job;
+    traceEvent(TraceEventType::IO_END, done.ready_time, job, -1,
+               static_cast<float>(done.ready_time - done.since));
+    job.startNextCpuBurst();
+    job.setReadyTime(done.ready_time);
+    job.setState(JobState::READY);
+    enqueue(std::move(job), false);
+}
+
+bool WorkerPool::acquireGlobalJob(int core_id, Job& job) {
+    {
+        ProfiledLock lock(queue_mutex_, lockProfile(core_id));
+
+        // Take the policy's next job out of the ready queue
+        if (ready_queue_.pop(job)) {
+            queued_jobs_.fetch_sub(1);
+            active_workers_.fetch_add(1);
+            return true;
+        }
+        if (!simulation_running_.load()) {
+            return false;   // Simulation over and queue drained
+        }
+        parked_.push_back(core_id);
+    }
+
+    // Parked: every later push happens under the queue lock and hands this
+    // core a job (handOffParked), so none can be missed
+    Handoff& handoff = *handoffs_[static_cast<std::size_t>(core_id)];
+    std::unique_lock<std::mutex> lock(handoff.mutex);
+    handoff.ready.wait(lock, [this, &handoff] {
+        return handoff.has_job || !simulation_running_.load();
+    });
+    if (!handoff.has_job) {
+        return false;
+    }
+    job = std::move(handoff.job);
+    handoff.has_job = false;
+    return true;
+}
+
+bool WorkerPool::acquireInTurn(int core_id, Job& job, double& now) {
+    while (turns_->wait(core_id)) {
+        {
+            ProfiledLock lock(queue_mutex_, lockProfile(core_id));
+            if (ready_queue_.pop(job)) {
+                queued_jobs_.fetch_sub(1);
+                active_workers_.fetch_add(1);
+                now = turns_->now();
+                return true;    // The turn is kept until the slice is set up
+            }
+            parked_.push_back(core_id);
+        }
+        turns_->pass(core_id);  // Idle until handOffParked() schedules this core
+    }
+    return false;
+}
+
+bool WorkerPool::acquireLocalJob(int core_id, Job& job) {
+    RunQueue& own = *run_queues_[core_id];
+
+    while (true) {
+        if (popFrom(core_id, own, job) || stealJob(core_id, job)) {
+            active_workers_.fetch_add(1);
+            return true;
+        }
+
+        if (!simulation_running_.load() && outstanding_jobs_.load() == 0) {
+            return false;
+        }
+
+        // Work exists somewhere but a peer beat us to it: look again
+        if (placement_->allowsStealing() && queued_jobs_.load() > 0) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(own.mutex);
+        own.job_available.wait_for(lock, STEAL_RETRY_INTERVAL, [this, &own] {
+            return own.length.load() > 0 || !simulation_running_.load();
+        });
+    }
+}
+
+bool WorkerPool::popFrom(int core_id, RunQueue& run_queue, Job& job) {
+    if (run_queue.length.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    ProfiledLock lock(run_queue.mutex, lockProfile(core_id));
+    if (!run_queue.queue->pop(job)) {
+        return false;
+    }
+    run_queue.length.fetch_sub(1);
+    queued_jobs_.fetch_sub(1);
+    return true;
+}
+
+const std::vector<std::size_t>& WorkerPool::queueLengths(int core_id) {
+    std::vector<std::size_t>& lengths = locals_[static_cast<std::size_t>(core_id)].queue_lengths;
+    snapshotLengths(lengths);
+    return lengths;
+}
+
+void WorkerPool::snapshotLengths(std::vector<std::size_t>& lengths) const {
+    for (int core = 0; core < num_cores_; ++core) {
+        lengths[core] = run_queues_[core]->length.load(std::memory_order_relaxed);
+    }
+}
+
+bool WorkerPool::stealJob(int thief_core, Job& job) {
+    if (!placement_->allowsStealing()) {
+        return false;
+    }
+
+    // Victim chosen by the placement policy from (unlocked) queue lengths
+    const int victim = placement_->stealFrom(thief_core, queueLengths(thief_core));
+    if (victim < 0 || victim >= num_cores_ || victim == thief_core ||
+        !popFrom(thief_core, *run_queues_[victim], job)) {
+        return false;
+    }
+    stolen_jobs_.fetch_add(1);
+    return true;
+}
+
+void WorkerPool::endSlice(int core_id, Job job, double finish_time) {
+    // A finished or blocking job goes back to no ready queue, so neither its
+    // policy hook (which then only touches the job or atomic policy state)
+    // nor its bookkeeping takes a queue lock
+    if (job.isFinished()) {
+        policy_.onJobCompletion(&job, finish_time);
+
+        // This core's own buffer, merged after the workers stop
+        locals_[static_cast<std::size_t>(core_id)].completed.append(job);
+        outstanding_jobs_.fetch_sub(1);
+        return;
+    }
+    if (job.getState() == JobState::WAITING) {
+        policy_.onJobCompletion(&job, finish_time);
+        beginIo(core_id, std::move(job), finish_time);
+        return;
+    }
+
+    // PER_CORE: a requeued job goes where the placement policy sends it
+    // (by default back to this core)
+    int target = core_id;
+    if (queue_mode_ == QueueMode::PER_CORE) {
+        target = placement_->requeueJob(job, queueLengths(core_id));
+        if (target < 0 || target >= num_cores_) {
+            target = core_id;
+        }
+    }
+
+    // The policy hook runs under the lock of the queue the job comes back to:
+    // the global queue lock, or the target run queue's lock in PER_CORE mode.
+    ProfiledLock lock(queue_mode_ == QueueMode::GLOBAL ? queue_mutex_ : run_queues_[target]->mutex,
+                      lockProfile(core_id));
+    policy_.onJobCompletion(&job, finish_time);
+
+    if (queue_mode_ == QueueMode::GLOBAL) {
+        ready_queue_.requeue(std::move(job));
+        queued_jobs_.fetch_add(1);
+        handOffParked();    // Idle peers get it (or more) under this same lock
+        return;
+    }
+
+    // Idle peers can still steal it unless the placement pins jobs
+    RunQueue& dest = *run_queues_[target];
+    dest.queue->requeue(std::move(job));
+    dest.length.fetch_add(1);
+    queued_jobs_.fetch_add(1);
+    if (target != core_id) {
+        lock.unlock();
+        dest.job_available.notify_one();
+    }
+}
+
+void WorkerPool::traceEvent(TraceEventType type, double time, const Job& job, int core_id,
+                            float value, std::int32_t aux) {
+    if (!trace_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(trace_mutex_);
+    trace_->record(type, time, job.getId(), core_id, value, aux);
+}
+
+float WorkerPool::executeJob(Job& job, float time_slice, float overhead, double run_start,
+                             int core_id, std::uint64_t acquired_at) {
+    if (execution_.real()) {
+        return runKernel(job, time_slice, run_start, core_id, acquired_at);
+    }
+
     // Simulate CPU execution by sleeping proportional to burst time
     // For simulation, we use milliseconds (1 second = 1000ms)
-    const int sleep_ms = static_cast<int>(time_slice * 1000.0f);
-    if (sleep_ms > 0) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+    const auto sleep_for =
+        std::chrono::milliseconds(static_cast<int>((overhead + time_slice) * 1000.0f));
+    if (slots_.empty()) {
+        if (sleep_for.count() > 0) {
+            std::this_thread::sleep_for(sleep_for);
+        }
+        return time_slice;
     }
-   
+
+    // Preemptible: sleep on the core's slot until the slice ends or an
+    // arrival cuts it short. In deterministic mode the worker armed the slot
+    // in its turn and disarms it in the next one.
+    if (!turns_) {
+        armSlot(core_id, job, run_start, time_slice);
+    }
+    CoreSlot& slot = *slots_[static_cast<std::size_t>(core_id)];
+    {
+        std::unique_lock<std::mutex> lock(slot.mutex);
+        slot.preempted.wait_for(lock, sleep_for, [&slot] { return slot.preempt_at >= 0.0; });
+    }
+    return turns_ ? time_slice : disarmSlot(core_id, run_start, time_slice);
+}
+
+void WorkerPool::armSlot(int core_id, const Job& job, double run_start, float slice) {
+    CoreSlot& slot = *slots_[static_cast<std::size_t>(core_id)];
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    slot.job = job;
+    slot.run_start = run_start;
+    slot.execution = slice;
+    slot.preempt_at = -1.0;
+    slot.cut.store(false, std::memory_order_relaxed);
+    slot.running = true;
+}
+
+float WorkerPool::disarmSlot(int core_id, double run_start, float slice) {
+    CoreSlot& slot = *slots_[static_cast<std::size_t>(core_id)];
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    slot.running = false;
+    if (slot.preempt_at < 0.0) {
+        return slice;
+    }
+    return std::min(slice, static_cast<float>(std::max(0.0, slot.preempt_at - run_start)));
+}
+
+float WorkerPool::runKernel(const Job& job, float time_slice, double run_start, int core_id,
+                            std::uint64_t acquired_at) {
+    WorkerLocal& local = locals_[static_cast<std::size_t>(core_id)];
+    CoreSlot* slot = slots_.empty() ? nullptr : slots_[static_cast<std::size_t>(core_id)].get();
+    if (slot && !turns_) {
+        armSlot(core_id, job, run_start, time_slice);
+    }
+
+    // An arrival that preempts this slice sets slot->cut, which stops the
+    // kernel within one stride of units
+    const auto units = static_cast<std::uint64_t>(
+        static_cast<double>(time_slice) * execution_.time_scale * units_per_second_);
+    const std::uint64_t start = CycleClock::now();
+    const std::uint64_t done = local.kernel->run(units, slot ? &slot->cut : nullptr);
+    const std::uint64_t end = CycleClock::now();
+
+    const double measured = CycleClock::toSeconds(end - start);
+    const double expected = static_cast<double>(done) / units_per_second_;
+    ExecutionStats& stats = local.execution;
+    ++stats.slices;
+    stats.planned_time += expected;
+    stats.measured_time += measured;
+    stats.dispatch_time += CycleClock::toSeconds(start - acquired_at);
+    stats.overrun.record(std::max(0.0, measured - expected));
+
+    if (!slot || turns_) {
+        return time_slice;
+    }
+    return disarmSlot(core_id, run_start, time_slice);
+}
+
+int WorkerPool::choosePreemptionVictim(const Job& arriving, int only_core, int& victim_job_id) {
+    // Pick the victim from per-core snapshots, one slot lock at a time
+    int victim = -1;
+    int idle = 0;
+    Job victim_job(0, 0.0f, 0.0f);
+    const int first = only_core >= 0 ? only_core : 0;
+    const int last = only_core >= 0 ? only_core + 1 : num_cores_;
+    for (int core = first; core < last; ++core) {
+        CoreSlot& slot = *slots_[static_cast<std::size_t>(core)];
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        if (!slot.running || slot.preempt_at >= 0.0) {
+            ++idle;
+            continue;
+        }
+        const float elapsed =
+            static_cast<float>(std::max(0.0, arriving.getReadyTime() - slot.run_start));
+        if (elapsed >= slot.execution - MIN_SLICE) {
+            continue;   // The slice ends by the arrival time anyway
+        }
+
+        // Show the policy the work left at the arrival instant
+        Job running = slot.job;
+        running.setRemainingTime(running.getRemainingTime() - elapsed);
+        if (!policy_.shouldPreempt(running, arriving)) {
+            continue;
+        }
+        // Among candidates, displace the one every other candidate beats
+        if (victim < 0 || policy_.shouldPreempt(running, victim_job)) {
+            victim = core;
+            victim_job = running;
+        }
+    }
+
+    // An idle core will pick up everything already queued plus this arrival
+    if (victim < 0 || static_cast<std::size_t>(idle) > queued_jobs_.load()) {
+        return -1;
+    }
+    victim_job_id = victim_job.getId();
+    return victim;
+}
+
+void WorkerPool::cutSlice(int core_id, int victim_job_id, double cut_time) {
+    CoreSlot& slot = *slots_[static_cast<std::size_t>(core_id)];
+    {
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        // The slice may have ended (and another started) since the victim was chosen
+        if (!slot.running || slot.preempt_at >= 0.0 || slot.job.getId() != victim_job_id) {
+            return;
+        }
+        slot.preempt_at = std::max(slot.run_start, cut_time);
+        slot.cut.store(true, std::memory_order_relaxed);
+        if (turns_) {
+            turns_->schedule(core_id, slot.preempt_at, TurnSequencer::Phase::RELEASE);
+        }
+    }
+    slot.preempted.notify_one();
+    preemptions_.fetch_add(1);
 }
 
-}
\ No newline at end of file
+}
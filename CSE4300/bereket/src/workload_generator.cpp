@@ -0,0 +1,384 @@
+#include "workload_generator.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace chronos {
+namespace {
+constexpr double PI = 3.14159265358979323846;
+
+// Shortest job the generator emits, so heavy-tailed draws never hit zero
+constexpr double MIN_SERVICE = 1e-3;
+
+std::uint64_t splitMix64(std::uint64_t& x) {
+    std::uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+std::string toUpper(std::string str) {
+    std::transform(str.begin(), str.end(), str.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+    return str;
+}
+}
+
+void Rng::reseed(std::uint64_t seed) {
+    // Expand the seed with SplitMix64, as xoshiro's authors recommend
+    for (std::uint64_t& word : state_) {
+        word = splitMix64(seed);
+    }
+    spare_normal_.reset();
+}
+
+int Rng::between(int lo, int hi) {
+    const std::uint64_t span = static_cast<std::uint64_t>(static_cast<std::int64_t>(hi) - lo) + 1;
+    return lo + static_cast<int>(((next() >> 32) * span) >> 32);
+}
+
+double Rng::normal() {
+    // Box-Muller yields two variates; keep the second for the next call
+    if (spare_normal_) {
+        const double value = *spare_normal_;
+        spare_normal_.reset();
+        return value;
+    }
+    const double radius = std::sqrt(-2.0 * std::log(uniformOpen()));
+    const double angle = 2.0 * PI * uniform();
+    spare_normal_ = radius * std::sin(angle);
+    return radius * std::cos(angle);
+}
+
+JobStream::JobStream(const GeneratorConfig& config)
+    : config_(config)
+    , rng_(config.seed)
+{
+    // MMPP rates chosen so (1 - share) x quiet + share x burst == rate
+    const double share = config_.burst_share;
+    quiet_rate_ = config_.rate / ((1.0 - share) + share * config_.burst_ratio);
+    burst_rate_ = quiet_rate_ * config_.burst_ratio;
+    burst_dwell_ = config_.burst_length / burst_rate_;
+    quiet_dwell_ = burst_dwell_ * (1.0 - share) / share;
+    if (config_.arrivals == ArrivalModel::MMPP) {
+        bursting_ = rng_.uniform() < share;
+        dwell_left_ = rng_.exponential(1.0 / (bursting_ ? burst_dwell_ : quiet_dwell_));
+    }
+
+    if (config_.tenants.empty()) {
+        config_.tenants.push_back(TenantMix());
+    }
+    double total = 0.0;
+    for (const TenantMix& tenant : config_.tenants) {
+        total += tenant.weight;
+    }
+    double sum = 0.0;
+    for (const TenantMix& tenant : config_.tenants) {
+        sum += tenant.weight / total;
+        tenant_cdf_.push_back(sum);
+    }
+    tenant_cdf_.back() = 1.0;
+
+    double slo_total = 0.0;
+    for (double weight : config_.slo_mix) {
+        slo_total += weight;
+    }
+    double slo_sum = 0.0;
+    for (double weight : config_.slo_mix) {
+        slo_sum += weight / slo_total;
+        slo_cdf_.push_back(slo_sum);
+    }
+    if (!slo_cdf_.empty()) {
+        slo_cdf_.back() = 1.0;
+    }
+}
+
+bool JobStream::next(Job& job) {
+    if (generated_ >= config_.num_jobs) {
+        return false;
+    }
+    ++generated_;
+
+    // Draw order (arrival, service, tenant, priority, then SLO class only
+    // with a mix) is part of the seed's meaning
+    const double arrival = nextArrival();
+    const double service = nextService();
+    const std::size_t tenant = nextTenant();
+    const int priority = nextPriority(tenant);
+    job = Job(static_cast<int>(generated_), arrival,
+              static_cast<float>(service), priority, static_cast<int>(tenant));
+
+    const SloClass slo = slo_cdf_.empty() ? SloClass::STANDARD : nextSloClass();
+    job.setSloClass(slo);
+    if (config_.deadline_slack > 0.0 && slo != SloClass::BEST_EFFORT) {
+        const double slack = slo == SloClass::CRITICAL ? config_.deadline_slack / 2.0
+                                                       : config_.deadline_slack;
+        job.setDeadline(arrival + service * (1.0 + slack));
+    }
+    return true;
+}
+
+std::vector<Job> JobStream::collect() {
+    std::vector<Job> jobs;
+    jobs.reserve(static_cast<std::size_t>(config_.num_jobs - generated_));
+    Job job(0, 0.0f, 0.0f);
+    while (next(job)) {
+        jobs.push_back(std::move(job));
+    }
+    return jobs;
+}
+
+double JobStream::nextArrival() {
+    switch (config_.arrivals) {
+        case ArrivalModel::POISSON:
+            now_ += rng_.exponential(config_.rate);
+            break;
+
+        case ArrivalModel::MMPP:
+            // Gaps are memoryless, so a gap that outlasts the current state is
+            // cut at the switch and redrawn at the new state's rate
+            while (true) {
+                const double gap = rng_.exponential(bursting_ ? burst_rate_ : quiet_rate_);
+                if (gap < dwell_left_) {
+                    dwell_left_ -= gap;
+                    now_ += gap;
+                    break;
+                }
+                now_ += dwell_left_;
+                bursting_ = !bursting_;
+                dwell_left_ = rng_.exponential(1.0 / (bursting_ ? burst_dwell_ : quiet_dwell_));
+            }
+            break;
+
+        case ArrivalModel::DIURNAL: {
+            // Thinning: candidates at the peak rate, kept with probability rate(t) / peak
+            const double peak = config_.rate * (1.0 + config_.amplitude);
+            while (true) {
+                now_ += rng_.exponential(peak);
+                const double rate = config_.rate *
+                    (1.0 + config_.amplitude * std::sin(2.0 * PI * now_ / config_.period));
+                if (rng_.uniform() * peak < rate) {
+                    break;
+                }
+            }
+            break;
+        }
+    }
+    return now_;
+}
+
+double JobStream::nextService() {
+    const double mean = config_.service_mean;
+    double service = mean;
+    switch (config_.service) {
+        case ServiceModel::UNIFORM:
+            service = rng_.uniform(0.2 * mean, 1.8 * mean);
+            break;
+
+        case ServiceModel::PARETO: {
+            // Scale x_m = mean (alpha - 1) / alpha gives the requested mean
+            const double alpha = config_.pareto_alpha;
+            const double scale = mean * (alpha - 1.0) / alpha;
+            service = scale / std::pow(rng_.uniformOpen(), 1.0 / alpha);
+            break;
+        }
+
+        case ServiceModel::LOGNORMAL: {
+            const double sigma = config_.lognormal_sigma;
+            const double mu = std::log(mean) - 0.5 * sigma * sigma;
+            service = std::exp(mu + sigma * rng_.normal());
+            break;
+        }
+
+        case ServiceModel::BIMODAL: {
+            // Two modes with +/-20% jitter, weighted so the overall mean is `mean`
+            const double share = config_.long_share;
+            const double short_mean = mean / ((1.0 - share) + share * config_.long_ratio);
+            const bool is_long = rng_.uniform() < share;
+            service = (is_long ? short_mean * config_.long_ratio : short_mean) * rng_.uniform(0.8, 1.2);
+            break;
+        }
+    }
+    return std::max(MIN_SERVICE, service);
+}
+
+std::size_t JobStream::nextTenant() {
+    const double pick = rng_.uniform();
+    std::size_t tenant = 0;
+    while (tenant + 1 < tenant_cdf_.size() && pick >= tenant_cdf_[tenant]) {
+        ++tenant;
+    }
+    return tenant;
+}
+
+int JobStream::nextPriority(std::size_t tenant) {
+    const TenantMix& mix = config_.tenants[tenant];
+    return rng_.between(mix.min_priority, mix.max_priority);
+}
+
+SloClass JobStream::nextSloClass() {
+    const double pick = rng_.uniform();
+    std::size_t slo = 0;
+    while (slo + 1 < slo_cdf_.size() && pick >= slo_cdf_[slo]) {
+        ++slo;
+    }
+    return static_cast<SloClass>(slo);
+}
+
+bool WorkloadGenerator::validate(const GeneratorConfig& config) {
+    if (config.num_jobs > static_cast<std::uint64_t>(INT_MAX)) {
+        std::cerr << "Error: at most " << INT_MAX << " jobs can be generated\n";
+        return false;
+    }
+    if (!(config.rate > 0.0)) {
+        std::cerr << "Error: arrival rate must be positive\n";
+        return false;
+    }
+    if (!(config.service_mean > 0.0)) {
+        std::cerr << "Error: mean service time must be positive\n";
+        return false;
+    }
+    if (!(config.burst_ratio >= 1.0) || !(config.burst_share > 0.0 && config.burst_share < 1.0) ||
+        !(config.burst_length > 0.0)) {
+        std::cerr << "Error: MMPP needs burst_ratio >= 1, 0 < burst_share < 1 and burst_length > 0\n";
+        return false;
+    }
+    if (!(config.period > 0.0) || !(config.amplitude >= 0.0 && config.amplitude <= 1.0)) {
+        std::cerr << "Error: diurnal arrivals need period > 0 and 0 <= amplitude <= 1\n";
+        return false;
+    }
+    if (!(config.pareto_alpha > 1.0)) {
+        std::cerr << "Error: Pareto tail index must be greater than 1\n";
+        return false;
+    }
+    if (!(config.lognormal_sigma > 0.0)) {
+        std::cerr << "Error: lognormal sigma must be positive\n";
+        return false;
+    }
+    if (!(config.long_share >= 0.0 && config.long_share <= 1.0) || !(config.long_ratio >= 1.0)) {
+        std::cerr << "Error: bimodal service needs 0 <= long_share <= 1 and long_ratio >= 1\n";
+        return false;
+    }
+    if (config.tenants.size() > static_cast<std::size_t>(MAX_TENANT) + 1) {
+        std::cerr << "Error: at most " << MAX_TENANT + 1 << " tenants can be generated\n";
+        return false;
+    }
+    for (const TenantMix& tenant : config.tenants) {
+        if (!(tenant.weight > 0.0) || tenant.min_priority > tenant.max_priority) {
+            std::cerr << "Error: each tenant needs a positive weight and min priority <= max priority\n";
+            return false;
+        }
+        if (tenant.min_priority < MIN_JOB_PRIORITY || tenant.max_priority > MAX_JOB_PRIORITY) {
+            std::cerr << "Error: tenant priorities must be in " << MIN_JOB_PRIORITY << " to "
+                      << MAX_JOB_PRIORITY << "\n";
+            return false;
+        }
+    }
+    if (!config.slo_mix.empty()) {
+        double total = 0.0;
+        for (double weight : config.slo_mix) {
+            if (!(weight >= 0.0)) {
+                std::cerr << "Error: SLO class shares must be non-negative\n";
+                return false;
+            }
+            total += weight;
+        }
+        if (config.slo_mix.size() > 3 || !(total > 0.0)) {
+            std::cerr << "Error: the SLO mix takes up to 3 shares (critical, standard, best-effort)"
+                      << " with a positive sum\n";
+            return false;
+        }
+    }
+    if (!(config.deadline_slack >= 0.0)) {
+        std::cerr << "Error: deadline slack must be non-negative\n";
+        return false;
+    }
+    return true;
+}
+
+std::string WorkloadGenerator::arrivalToString(ArrivalModel model) {
+    switch (model) {
+        case ArrivalModel::POISSON: return "poisson";
+        case ArrivalModel::MMPP:    return "mmpp";
+        case ArrivalModel::DIURNAL: return "diurnal";
+        default:                    return "Unknown";
+    }
+}
+
+std::optional<ArrivalModel> WorkloadGenerator::stringToArrival(const std::string& str) {
+    const std::string upper_str = toUpper(str);
+    if (upper_str == "POISSON") {
+        return ArrivalModel::POISSON;
+    } else if (upper_str == "MMPP" || upper_str == "BURSTY") {
+        return ArrivalModel::MMPP;
+    } else if (upper_str == "DIURNAL") {
+        return ArrivalModel::DIURNAL;
+    }
+    return std::nullopt;
+}
+
+std::string WorkloadGenerator::serviceToString(ServiceModel model) {
+    switch (model) {
+        case ServiceModel::UNIFORM:   return "uniform";
+        case ServiceModel::PARETO:    return "pareto";
+        case ServiceModel::LOGNORMAL: return "lognormal";
+        case ServiceModel::BIMODAL:   return "bimodal";
+        default:                      return "Unknown";
+    }
+}
+
+std::optional<ServiceModel> WorkloadGenerator::stringToService(const std::string& str) {
+    const std::string upper_str = toUpper(str);
+    if (upper_str == "UNIFORM") {
+        return ServiceModel::UNIFORM;
+    } else if (upper_str == "PARETO") {
+        return ServiceModel::PARETO;
+    } else if (upper_str == "LOGNORMAL") {
+        return ServiceModel::LOGNORMAL;
+    } else if (upper_str == "BIMODAL") {
+        return ServiceModel::BIMODAL;
+    }
+    return std::nullopt;
+}
+
+bool WorkloadGenerator::parseTenants(const std::string& spec, std::vector<TenantMix>& tenants) {
+    std::stringstream list(spec);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        TenantMix tenant;
+        const std::size_t colon = item.find(':');
+        try {
+            if (colon == std::string::npos) {
+                throw std::invalid_argument("missing ':'");
+            }
+            tenant.weight = std::stod(item.substr(0, colon));
+            const std::string range = item.substr(colon + 1);
+            const std::size_t dash = range.find('-', 1);
+            tenant.min_priority = std::stoi(range.substr(0, dash));
+            tenant.max_priority = dash == std::string::npos ? tenant.min_priority
+                                                            : std::stoi(range.substr(dash + 1));
+        } catch (const std::exception& e) {
+            std::cerr << "Error: --tenants entry '" << item
+                      << "' must be WEIGHT:PRIORITY or WEIGHT:MIN-MAX\n";
+            return false;
+        }
+        if (!(tenant.weight > 0.0) || tenant.min_priority > tenant.max_priority) {
+            std::cerr << "Error: --tenants entry '" << item
+                      << "' needs a positive weight and MIN <= MAX\n";
+            return false;
+        }
+        tenants.push_back(tenant);
+    }
+
+    if (tenants.empty()) {
+        std::cerr << "Error: --tenants requires at least one entry\n";
+        return false;
+    }
+    return true;
+}
+
+}
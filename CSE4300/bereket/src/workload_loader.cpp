@@ -0,0 +1,481 @@
+#include "workload_loader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace chronos {
+namespace {
+constexpr char WORKLOAD_MAGIC[8] = {'C', 'H', 'R', 'J', 'O', 'B', 'S', '\0'};
+constexpr int MAX_COLUMNS = 64;
+
+// Read-only view of a whole file (memory-mapped where available)
+class MappedFile {
+public:
+    bool open(const std::string& path) {
+#ifndef _WIN32
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            return false;
+        }
+        struct stat st;
+        if (::fstat(fd_, &st) != 0) {
+            return false;
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ == 0) {
+            return true;
+        }
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (addr == MAP_FAILED) {
+            return false;
+        }
+        addr_ = addr;
+        ::madvise(addr_, size_, MADV_SEQUENTIAL);
+        return true;
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return false;
+        }
+        buffer_.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        size_ = buffer_.size();
+        return static_cast<bool>(file);
+#endif
+    }
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (addr_) {
+            ::munmap(addr_, size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    const char* data() const {
+#ifndef _WIN32
+        return static_cast<const char*>(addr_);
+#else
+        return buffer_.data();
+#endif
+    }
+    std::size_t size() const { return size_; }
+
+private:
+#ifndef _WIN32
+    int fd_ = -1;
+    void* addr_ = nullptr;
+#else
+    std::vector<char> buffer_;
+#endif
+    std::size_t size_ = 0;
+};
+
+std::string_view trim(std::string_view field) {
+    while (!field.empty() && (field.front() == ' ' || field.front() == '\t' || field.front() == '"')) {
+        field.remove_prefix(1);
+    }
+    while (!field.empty() && (field.back() == ' ' || field.back() == '\t' ||
+                              field.back() == '\r' || field.back() == '"')) {
+        field.remove_suffix(1);
+    }
+    return field;
+}
+
+template<typename T>
+bool parseNumber(std::string_view field, T& value) {
+    field = trim(field);
+    if (!field.empty() && field.front() == '+') {
+        field.remove_prefix(1);
+    }
+    const char* end = field.data() + field.size();
+    auto [ptr, ec] = std::from_chars(field.data(), end, value);
+    return ec == std::errc() && ptr == end;
+}
+
+bool iequals(std::string_view lhs, std::string_view rhs) {
+    return lhs.size() == rhs.size() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](char a, char b) {
+               return std::tolower(static_cast<unsigned char>(a)) ==
+                      std::tolower(static_cast<unsigned char>(b));
+           });
+}
+
+// Split one line into at most MAX_COLUMNS fields; returns the field count
+int splitFields(std::string_view line, std::string_view* fields) {
+    int count = 0;
+    std::size_t begin = 0;
+    while (count < MAX_COLUMNS) {
+        const std::size_t comma = line.find(',', begin);
+        fields[count++] = line.substr(begin, comma == std::string_view::npos ? comma : comma - begin);
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        begin = comma + 1;
+    }
+    return count;
+}
+
+bool isBlank(std::string_view line) {
+    return trim(line).empty();
+}
+
+// Parse a "cpu;io;cpu..." burst list: an odd number of finite positive values
+bool parseBursts(std::string_view field, std::vector<float>& bursts) {
+    bursts.clear();
+    field = trim(field);
+    while (!field.empty()) {
+        const std::size_t semicolon = field.find(';');
+        float value = 0.0f;
+        if (!parseNumber(field.substr(0, semicolon), value) || !std::isfinite(value) ||
+            !(value > 0.0f)) {
+            return false;
+        }
+        bursts.push_back(value);
+        field = semicolon == std::string_view::npos ? std::string_view() : field.substr(semicolon + 1);
+    }
+    return bursts.size() % 2 == 1 && bursts.size() <= 0xFFFF;
+}
+
+// Where a job was read from (record index or line number) in the low 32 bits
+// under its id, so sorting the keys brings repeated ids together
+std::uint64_t idKey(int id, std::size_t where) {
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(id)) << 32 |
+           static_cast<std::uint32_t>(where);
+}
+
+// The key of the second job to reuse an id, if any
+std::optional<std::uint64_t> findDuplicateId(std::vector<std::uint64_t>& keys) {
+    std::sort(keys.begin(), keys.end());
+    for (std::size_t i = 1; i < keys.size(); ++i) {
+        if (keys[i] >> 32 == keys[i - 1] >> 32) {
+            return keys[i];
+        }
+    }
+    return std::nullopt;
+}
+} // namespace
+
+bool WorkloadLoader::load(const std::string& path, std::vector<Job>& jobs, std::size_t max_jobs) {
+    MappedFile file;
+    if (!file.open(path)) {
+        std::cerr << "Error: Could not open workload file: " << path << "\n";
+        return false;
+    }
+
+    jobs.clear();
+    const bool ok = (file.size() >= sizeof(WORKLOAD_MAGIC) &&
+                     std::memcmp(file.data(), WORKLOAD_MAGIC, sizeof(WORKLOAD_MAGIC)) == 0)
+                        ? parseBinary(file.data(), file.size(), path, jobs, max_jobs)
+                        : parseCSV(file.data(), file.size(), path, jobs, max_jobs);
+    if (!ok) {
+        return false;
+    }
+
+    if (jobs.empty()) {
+        std::cerr << "Error: Workload file contains no jobs: " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool WorkloadLoader::parseBinary(const char* data, std::size_t size, const std::string& path,
+                                 std::vector<Job>& jobs, std::size_t max_jobs) {
+    WorkloadHeader header;
+    if (size < sizeof(header)) {
+        std::cerr << "Error: Truncated workload header: " << path << "\n";
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    const std::size_t record_size = sizeof(WorkloadRecord);
+    if (header.version != VERSION || header.record_size != record_size) {
+        std::cerr << "Error: Unsupported workload version " << header.version
+                  << " in " << path << " (expected " << VERSION << ")\n";
+        return false;
+    }
+
+    std::size_t count = static_cast<std::size_t>(header.job_count);
+    const std::size_t available = (size - sizeof(header)) / record_size;
+    if (count > available) {
+        std::cerr << "Error: Workload file is truncated (" << available << " of "
+                  << count << " jobs): " << path << "\n";
+        return false;
+    }
+    if (max_jobs > 0) {
+        count = std::min(count, max_jobs);
+    }
+
+    jobs.reserve(count);
+    std::vector<std::uint64_t> ids;
+    ids.reserve(count);
+    const char* cursor = data + sizeof(header);
+    for (std::size_t i = 0; i < count; ++i, cursor += record_size) {
+        WorkloadRecord record;
+        std::memcpy(&record, cursor, record_size);
+        // Raw floats can be nan or inf, which the range checks alone let through
+        if (record.job_id < 0 || !std::isfinite(record.arrival_time) || record.arrival_time < 0.0 ||
+            !std::isfinite(record.burst_time) || !(record.burst_time > 0.0f) ||
+            std::isnan(record.deadline) ||
+            record.slo_class > static_cast<std::uint8_t>(SloClass::BEST_EFFORT)) {
+            std::cerr << "Error: Invalid job " << record.job_id << " (record " << i
+                      << ") in " << path
+                      << ": id must be >= 0, arrival finite and >= 0, burst finite and > 0"
+                      << " and SLO class 0-2\n";
+            jobs.clear();
+            return false;
+        }
+        ids.push_back(idKey(record.job_id, i));
+        jobs.emplace_back(record.job_id, record.arrival_time, record.burst_time, record.priority,
+                          record.tenant);
+        jobs.back().setDeadline(record.deadline);
+        jobs.back().setSloClass(static_cast<SloClass>(record.slo_class));
+    }
+
+    if (const auto duplicate = findDuplicateId(ids)) {
+        std::cerr << "Error: Duplicate job id " << (*duplicate >> 32) << " (record "
+                  << (*duplicate & 0xFFFFFFFFu) << ") in " << path << "\n";
+        jobs.clear();
+        return false;
+    }
+    return true;
+}
+
+bool WorkloadLoader::parseCSV(const char* data, std::size_t size, const std::string& path,
+                              std::vector<Job>& jobs, std::size_t max_jobs) {
+    if (size == 0) {
+        return true;
+    }
+    const std::string_view text(data, size);
+
+    // One pass with memchr to size the job vector exactly
+    std::size_t lines = 0;
+    for (const char* p = data; (p = static_cast<const char*>(std::memchr(p, '\n', data + size - p)));
+         ++p) {
+        ++lines;
+    }
+    ++lines;
+    jobs.reserve(max_jobs > 0 ? std::min(lines, max_jobs) : lines);
+
+    // Column positions; headerless files are arrival,burst[,priority]
+    int id_column = -1;
+    int arrival_column = 0;
+    int burst_column = 1;
+    int priority_column = 2;
+    int tenant_column = -1;
+    int deadline_column = -1;
+    int slo_column = -1;
+    int bursts_column = -1;
+    std::vector<float> bursts;
+    std::vector<std::uint64_t> ids;     // Only filled from an id column
+
+    std::string_view fields[MAX_COLUMNS];
+    std::size_t line_number = 0;
+    std::size_t pos = 0;
+    bool first_line = true;
+    int next_id = 1;
+
+    while (pos < text.size() && (max_jobs == 0 || jobs.size() < max_jobs)) {
+        std::size_t newline = text.find('\n', pos);
+        if (newline == std::string_view::npos) {
+            newline = text.size();
+        }
+        const std::string_view line = text.substr(pos, newline - pos);
+        pos = newline + 1;
+        ++line_number;
+
+        if (isBlank(line) || trim(line).front() == '#') {
+            continue;
+        }
+
+        const int count = splitFields(line, fields);
+
+        if (first_line) {
+            first_line = false;
+            float probe;
+            if (!parseNumber(fields[0], probe)) {
+                // Header row: map known column names
+                id_column = arrival_column = burst_column = priority_column = tenant_column =
+                    deadline_column = slo_column = bursts_column = -1;
+                for (int i = 0; i < count; ++i) {
+                    const std::string_view name = trim(fields[i]);
+                    if (iequals(name, "job_id") || iequals(name, "id")) {
+                        id_column = i;
+                    } else if (iequals(name, "arrival_time") || iequals(name, "arrival")) {
+                        arrival_column = i;
+                    } else if (iequals(name, "burst_time") || iequals(name, "burst")) {
+                        burst_column = i;
+                    } else if (iequals(name, "priority")) {
+                        priority_column = i;
+                    } else if (iequals(name, "tenant")) {
+                        tenant_column = i;
+                    } else if (iequals(name, "deadline")) {
+                        deadline_column = i;
+                    } else if (iequals(name, "slo")) {
+                        slo_column = i;
+                    } else if (iequals(name, "bursts")) {
+                        bursts_column = i;
+                    }
+                }
+                if (arrival_column < 0 || (burst_column < 0 && bursts_column < 0)) {
+                    std::cerr << "Error: Workload header in " << path
+                              << " needs arrival_time and burst_time (or bursts) columns\n";
+                    return false;
+                }
+                continue;
+            }
+        }
+
+        double arrival = 0.0;
+        float burst = 0.0f;
+        int priority = 0;
+        int tenant = 0;
+        double deadline = Job::NO_DEADLINE;
+        std::optional<SloClass> slo = SloClass::STANDARD;
+        int id = next_id;
+        // A non-empty bursts field (cpu;io;cpu...) replaces the burst column
+        const bool has_bursts = bursts_column >= 0 && bursts_column < count &&
+                                !trim(fields[bursts_column]).empty();
+        bool ok = arrival_column < count && parseNumber(fields[arrival_column], arrival);
+        if (ok && has_bursts) {
+            ok = parseBursts(fields[bursts_column], bursts);
+            burst = ok ? bursts.front() : 0.0f;
+        } else if (ok) {
+            ok = burst_column >= 0 && burst_column < count &&
+                 parseNumber(fields[burst_column], burst);
+        }
+        if (ok && priority_column >= 0 && priority_column < count) {
+            ok = parseNumber(fields[priority_column], priority);
+        }
+        if (ok && tenant_column >= 0 && tenant_column < count) {
+            ok = parseNumber(fields[tenant_column], tenant) && tenant >= 0 && tenant <= MAX_TENANT;
+        }
+        if (ok && deadline_column >= 0 && deadline_column < count &&
+            !trim(fields[deadline_column]).empty()) {
+            ok = parseNumber(fields[deadline_column], deadline) && deadline >= arrival;
+        }
+        if (ok && slo_column >= 0 && slo_column < count && !trim(fields[slo_column]).empty()) {
+            slo = stringToSloClass(std::string(trim(fields[slo_column])));
+            ok = slo.has_value();
+        }
+        if (ok && id_column >= 0) {
+            ok = id_column < count && parseNumber(fields[id_column], id) && id >= 0;
+        }
+        // from_chars accepts "nan" and "inf", which the range checks alone let through
+        if (!ok || !std::isfinite(arrival) || arrival < 0.0 || !std::isfinite(burst) ||
+            !(burst > 0.0f) || priority < MIN_JOB_PRIORITY ||
+            priority > MAX_JOB_PRIORITY) {
+            std::cerr << "Error: " << path << ":" << line_number
+                      << ": expected an id >= 0, a finite arrival >= 0, a finite burst > 0,"
+                      << " a 16-bit integer priority,"
+                      << " a tenant in 0-" << MAX_TENANT
+                      << ", a deadline >= arrival and an SLO class"
+                      << (has_bursts ? " (bursts: cpu;io;...;cpu, all finite and > 0)" : "") << "\n";
+            jobs.clear();
+            return false;
+        }
+
+        jobs.emplace_back(id, arrival, burst, priority, tenant);
+        jobs.back().setDeadline(deadline);
+        jobs.back().setSloClass(*slo);
+        if (has_bursts) {
+            jobs.back().setBursts(bursts);
+        }
+        if (id_column >= 0) {
+            ids.push_back(idKey(id, line_number));
+        }
+        next_id = id + 1;
+    }
+
+    if (const auto duplicate = findDuplicateId(ids)) {
+        std::cerr << "Error: " << path << ":" << (*duplicate & 0xFFFFFFFFu)
+                  << ": duplicate job id " << (*duplicate >> 32) << "\n";
+        jobs.clear();
+        return false;
+    }
+    return true;
+}
+
+bool WorkloadLoader::saveBinary(const std::string& path, const std::vector<Job>& jobs) {
+    std::size_t index = 0;
+    return saveBinary(path, [&jobs, &index](Job& job) {
+        if (index == jobs.size()) {
+            return false;
+        }
+        job = jobs[index++];
+        return true;
+    });
+}
+
+bool WorkloadLoader::saveBinary(const std::string& path, const std::function<bool(Job&)>& next) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Error: Could not open file for writing: " << path << "\n";
+        return false;
+    }
+
+    // The job count is unknown until the source runs dry; it is patched in at the end
+    WorkloadHeader header;
+    std::memcpy(header.magic, WORKLOAD_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.record_size = sizeof(WorkloadRecord);
+    header.job_count = 0;
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+
+    // Convert in blocks so a 10M-job set needs no full-size staging copy
+    constexpr std::size_t BLOCK = 64 * 1024;
+    std::vector<WorkloadRecord> block;
+    block.reserve(BLOCK);
+    std::size_t with_io = 0;
+    Job job(0, 0.0f, 0.0f);
+    bool more = true;
+    while (ok && more) {
+        block.clear();
+        while (block.size() < BLOCK && (more = next(job))) {
+            with_io += job.hasIoBursts() ? 1 : 0;
+            block.push_back(WorkloadRecord{job.getArrivalTime(), job.getDeadline(), job.getId(),
+                                           job.getBurstTime(),
+                                           static_cast<std::int16_t>(job.getPriority()),
+                                           static_cast<std::uint16_t>(job.getTenant()),
+                                           static_cast<std::uint8_t>(job.getSloClass()), {}});
+        }
+        ok = std::fwrite(block.data(), sizeof(WorkloadRecord), block.size(), file) == block.size();
+        header.job_count += block.size();
+    }
+
+    if (with_io > 0) {
+        std::cerr << "Warning: the binary format has no I/O bursts; " << with_io
+                  << " job(s) saved as a single CPU burst\n";
+    }
+
+    ok = ok && std::fseek(file, 0, SEEK_SET) == 0 &&
+         std::fwrite(&header, sizeof(header), 1, file) == 1;
+    if (std::fclose(file) != 0 || !ok) {
+        std::cerr << "Error: Failed to write to file: " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+}
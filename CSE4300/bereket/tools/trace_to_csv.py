@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+Converts a binary Chronos trace (schedsim --trace) back to CSV:
+- metrics.csv with the same columns as FileWriter, so visualize.py keeps working
+- optionally a per-slice CSV (one row per dispatch) for finer-grained timelines
+
+Usage: trace_to_csv.py <trace.bin> [metrics.csv] [--slices slices.csv]
+"""
+
+import csv
+import os
+import struct
+import sys
+from typing import Dict, List, Tuple
+
+HEADER = struct.Struct('<8sIIQ40s')     # TraceHeader (64 bytes)
+RECORD = struct.Struct('<dihBBfi')      # TraceRecord (24 bytes)
+MAGIC = b'CHRTRACE'
+
+ARRIVAL, DISPATCH, SLICE_END, COMPLETION, IO_START, IO_END = range(6)
+
+
+def f32(value: float) -> float:
+    # The simulator keeps job times as float; round the same way
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+def read_trace(filename: str) -> Tuple[str, List[Tuple]]:
+    with open(filename, 'rb') as f:
+        data = f.read()
+
+    if len(data) < HEADER.size:
+        raise ValueError(f"{filename} is too short to be a trace")
+
+    magic, version, record_size, record_count, algorithm = HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError(f"{filename} is not a Chronos trace")
+    if version != 1 or record_size != RECORD.size:
+        raise ValueError(f"Unsupported trace version {version} (record size {record_size})")
+
+    available = (len(data) - HEADER.size) // RECORD.size
+    if record_count > available:
+        print(f"Warning: {filename} is truncated ({available} of {record_count} records)")
+        record_count = available
+
+    records = list(RECORD.iter_unpack(data[HEADER.size:HEADER.size + record_count * RECORD.size]))
+    return algorithm.split(b'\0', 1)[0].decode(), records
+
+
+def write_metrics_csv(algorithm: str, records: List[Tuple], filename: str) -> int:
+    jobs: Dict[int, Dict] = {}
+    completed: List[int] = []
+
+    for time, job_id, core, kind, _, value, aux in records:
+        if kind == ARRIVAL:
+            jobs[job_id] = {'arrival': f32(time), 'burst': value, 'priority': aux, 'start': -1.0}
+        elif kind == DISPATCH and aux == 1 and job_id in jobs:
+            jobs[job_id]['start'] = f32(time)
+        elif kind == COMPLETION and job_id in jobs:
+            jobs[job_id]['finish'] = f32(time)
+            completed.append(job_id)
+
+    with open(filename, 'w', newline='') as f:
+        writer = csv.writer(f, lineterminator='\n')
+        writer.writerow(['algorithm', 'job_id', 'arrival_time', 'burst_time', 'priority',
+                         'start_time', 'finish_time', 'waiting_time', 'turnaround_time',
+                         'remaining_time'])
+        # Completion order, same as the simulator's completed job list
+        for job_id in completed:
+            job = jobs[job_id]
+            waiting = max(0.0, f32(job['start'] - job['arrival']))
+            turnaround = f32(job['finish'] - job['arrival'])
+            writer.writerow([algorithm, job_id,
+                             f"{job['arrival']:.2f}", f"{job['burst']:.2f}", job['priority'],
+                             f"{job['start']:.2f}", f"{job['finish']:.2f}",
+                             f"{waiting:.2f}", f"{turnaround:.2f}", "0.00"])
+
+    return len(completed)
+
+
+def write_slices_csv(algorithm: str, records: List[Tuple], filename: str) -> int:
+    rows = []
+    running: Dict[int, int] = {}    # job id -> row of its current slice
+    for time, job_id, core, kind, _, value, aux in records:
+        if kind == DISPATCH:
+            running[job_id] = len(rows)
+            rows.append([time, job_id, core, time + value, 1 if aux == 1 else 0])
+        elif kind == SLICE_END and aux == 1 and job_id in running:
+            # Preempted by an arrival: the slice ended early
+            rows[running[job_id]][3] = time
+    rows.sort()
+
+    with open(filename, 'w', newline='') as f:
+        writer = csv.writer(f, lineterminator='\n')
+        writer.writerow(['algorithm', 'job_id', 'core', 'start_time', 'end_time', 'first_dispatch'])
+        for start, job_id, core, end, first in rows:
+            writer.writerow([algorithm, job_id, core, f"{start:.4f}", f"{end:.4f}", first])
+
+    return len(rows)
+
+
+def main():
+    args = sys.argv[1:]
+    slices_file = None
+    if '--slices' in args:
+        index = args.index('--slices')
+        if index + 1 >= len(args):
+            print("Error: --slices requires a file path")
+            sys.exit(1)
+        slices_file = args[index + 1]
+        del args[index:index + 2]
+
+    if not args or len(args) > 2:
+        print(__doc__.strip())
+        sys.exit(1)
+
+    trace_file = args[0]
+    metrics_file = args[1] if len(args) > 1 else os.path.join('output', 'metrics.csv')
+
+    try:
+        algorithm, records = read_trace(trace_file)
+    except (OSError, ValueError) as e:
+        print(f"Error reading {trace_file}: {e}")
+        sys.exit(1)
+
+    count = write_metrics_csv(algorithm, records, metrics_file)
+    print(f"{trace_file}: {len(records)} events, {count} completed jobs -> {metrics_file}")
+
+    if slices_file:
+        count = write_slices_csv(algorithm, records, slices_file)
+        print(f"{count} slices -> {slices_file}")
+
+
+if __name__ == '__main__':
+    main()